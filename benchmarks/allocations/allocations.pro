@@ -0,0 +1,8 @@
+QT = core testlib
+
+TEMPLATE = app
+TARGET = tst_bench_allocations
+
+SOURCES += main.cpp
+
+include(../../src/verdigris.pri)
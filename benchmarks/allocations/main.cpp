@@ -0,0 +1,96 @@
+/****************************************************************************
+ *  Copyright (C) 2026 Woboq GmbH
+ *  Olivier Goffart <contact at woboq.com>
+ *  https://woboq.com/
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this program.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <wobjectimpl.h>
+#include <wobjectpool.h>
+#include <QtTest/QtTest>
+#include <cstdlib>
+#include <new>
+
+// Counts the allocations of the current thread while countAllocations is set.
+// The global operator new is replaced, which is why this is not part of the qobject benchmark.
+static thread_local bool countAllocations = false;
+static thread_local qint64 allocationCount = 0;
+void *operator new(std::size_t size)
+{
+    if (countAllocations)
+        ++allocationCount;
+    if (void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+class Sender : public QObject
+{
+    W_OBJECT(Sender)
+public:
+    void triggered() W_SIGNAL(triggered)
+};
+W_OBJECT_IMPL(Sender)
+
+class AllocationsBenchmark : public QObject
+{
+    W_OBJECT(AllocationsBenchmark)
+
+private:
+    void pooled_connect_benchmark_data();
+    W_SLOT(pooled_connect_benchmark_data, W_Access::Private)
+    void pooled_connect_benchmark();
+    W_SLOT(pooled_connect_benchmark, W_Access::Private)
+};
+
+void AllocationsBenchmark::pooled_connect_benchmark_data()
+{
+    QTest::addColumn<bool>("pooled"); // w_cpp::connectPooled instead of QObject::connect
+
+    QTest::newRow("w functor") << false;
+    QTest::newRow("w pooled functor") << true;
+}
+
+// The allocations of 1000 connections and disconnections of a functor
+void AllocationsBenchmark::pooled_connect_benchmark()
+{
+    QFETCH(bool, pooled);
+    Sender obj;
+    int count = 0;
+    auto functor = [&count] { ++count; };
+    auto connectDisconnect = [&] {
+        if (pooled)
+            w_cpp::disconnect(w_cpp::connectPooled(&obj, &Sender::triggered, functor));
+        else
+            QObject::disconnect(QObject::connect(&obj, &Sender::triggered, functor));
+    };
+    // the first pooled connection creates the connection of the dispatcher and fills the pool
+    connectDisconnect();
+    qint64 allocations = 0;
+    QBENCHMARK {
+        allocationCount = 0;
+        countAllocations = true;
+        for (int i = 0; i < 1000; ++i)
+            connectDisconnect();
+        countAllocations = false;
+        allocations = allocationCount;
+    }
+    QTest::setBenchmarkResult(allocations, QTest::Events);
+}
+
+QTEST_MAIN(AllocationsBenchmark)
+W_OBJECT_IMPL(AllocationsBenchmark)
@@ -1,4 +1,4 @@
 TEMPLATE = subdirs
 
-SUBDIRS += qobject
+SUBDIRS += qobject allocations
 
@@ -5,7 +5,11 @@
 
 #include <wobjectimpl.h>
 
+#ifdef OUTLINE_SIGNALS
+#define CS_OBJECT(X) W_OBJECT(X) W_OUTLINE_SIGNALS
+#else
 #define CS_OBJECT(X) W_OBJECT(X)
+#endif
 #define CS_OBJECT_MULTIPLE(X,XX) W_OBJECT(X)
 #define CS_SLOT_1(XX,...) __VA_ARGS__;
 #define CS_SLOT_2(X) W_SLOT(X)
@@ -1052,6 +1056,7 @@ W_OBJECT_IMPL(Object12)
  $CXX compile.cpp -I $CS_HOME/include -I $CS_HOME/include/QtCore -std=c++14 -O2 -c -o /dev/null
 
  $CXX compile.cpp -I/usr/include/qt -I/usr/include/qt/QtCore -std=c++14 -O2 -fPIC -c -o /dev/null -I../../src -DUSE_VERDIGRIS
+ $CXX compile.cpp -I/usr/include/qt -I/usr/include/qt/QtCore -std=c++14 -O2 -fPIC -c -o /dev/null -I../../src -DUSE_VERDIGRIS -DOUTLINE_SIGNALS
 
  moc compile.cpp -I/use/include/qt -I/usr/include/qt/QtCore -o moc_compile.h -DUSE_QT
  $CXX compile.cpp -I/usr/include/qt -I/usr/include/qt/QtCore -std=c++14 -O2 -fPIC -c -o /dev/null -DUSE_QT
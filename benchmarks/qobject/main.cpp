@@ -28,6 +28,7 @@
 #include <QtCore>
 #include <qtest.h>
 #include "object.h"
+#include <wobjectpool.h>
 #include <qcoreapplication.h>
 #include <qdatetime.h>
 
@@ -45,6 +46,45 @@ private slots:
 
     void connect_disconnect_benchmark_data();
     void connect_disconnect_benchmark();
+
+    void payload_signal_benchmark_data();
+    void payload_signal_benchmark();
+
+    void invoke_method_benchmark_data();
+    void invoke_method_benchmark();
+
+    void metacast_benchmark_data();
+    void metacast_benchmark();
+
+    void create_instance_benchmark_data();
+    void create_instance_benchmark();
+
+    void property_access_benchmark_data();
+    void property_access_benchmark();
+
+    void property_copy_benchmark_data();
+    void property_copy_benchmark();
+
+    void property_chain_benchmark_data();
+    void property_chain_benchmark();
+
+    void index_of_property_benchmark_data();
+    void index_of_property_benchmark();
+
+    void index_of_method_benchmark_data();
+    void index_of_method_benchmark();
+
+    void typed_invoke_benchmark_data();
+    void typed_invoke_benchmark();
+
+    void static_connect_benchmark_data();
+    void static_connect_benchmark();
+
+    void pooled_connect_benchmark_data();
+    void pooled_connect_benchmark();
+
+    void property_transaction_benchmark_data();
+    void property_transaction_benchmark();
 };
 
 struct Functor {
@@ -54,20 +94,29 @@ struct Functor {
 void QObjectBenchmark::signal_slot_benchmark_data()
 {
     QTest::addColumn<int>("type");
-    QTest::addColumn<bool>("w");
-    QTest::newRow("simple function") << 0    << false;
-    QTest::newRow("single signal/slot") << 1 << false;
-    QTest::newRow("multi signal/slot") << 2  << false;
-    QTest::newRow("unconnected signal") << 3 << false;
-    QTest::newRow("single signal/ptr") << 4  << false;
-    QTest::newRow("functor") << 5            << false;
+    QTest::addColumn<int>("w"); // 0: moc, 1: verdigris, 2: verdigris with W_SKIP_UNCONNECTED_SIGNALS, 3: with W_OUTLINE_SIGNALS
+    QTest::newRow("simple function") << 0    << 0;
+    QTest::newRow("single signal/slot") << 1 << 0;
+    QTest::newRow("multi signal/slot") << 2  << 0;
+    QTest::newRow("unconnected signal") << 3 << 0;
+    QTest::newRow("single signal/ptr") << 4  << 0;
+    QTest::newRow("functor") << 5            << 0;
+
+    QTest::newRow("w simple function") << 0    << 1;
+    QTest::newRow("w single signal/slot") << 1 << 1;
+    QTest::newRow("w multi signal/slot") << 2  << 1;
+    QTest::newRow("w unconnected signal") << 3 << 1;
+    QTest::newRow("w single signal/ptr") << 4  << 1;
+    QTest::newRow("w functor") << 5            << 1;
 
-    QTest::newRow("w simple function") << 0    << true;
-    QTest::newRow("w single signal/slot") << 1 << true;
-    QTest::newRow("w multi signal/slot") << 2  << true;
-    QTest::newRow("w unconnected signal") << 3 << true;
-    QTest::newRow("w single signal/ptr") << 4  << true;
-    QTest::newRow("w functor") << 5            << true;
+    QTest::newRow("w skip single signal/slot") << 1 << 2;
+    QTest::newRow("w skip unconnected signal") << 3 << 2;
+    QTest::newRow("w skip functor") << 5            << 2;
+
+    QTest::newRow("w outlined single signal/slot") << 1 << 3;
+    QTest::newRow("w outlined multi signal/slot") << 2  << 3;
+    QTest::newRow("w outlined unconnected signal") << 3 << 3;
+    QTest::newRow("w outlined functor") << 5            << 3;
 
 }
 
@@ -135,8 +184,10 @@ void signal_slot_benchmark()
 
 void QObjectBenchmark::signal_slot_benchmark()
 {
-    QFETCH(bool, w);
-    if (w) ::signal_slot_benchmark<ObjectW>();
+    QFETCH(int, w);
+    if (w == 3) ::signal_slot_benchmark<ObjectWOutlined>();
+    else if (w == 2) ::signal_slot_benchmark<ObjectWSkip>();
+    else if (w) ::signal_slot_benchmark<ObjectW>();
     else ::signal_slot_benchmark<Object>();
 }
 
@@ -160,6 +211,9 @@ void QObjectBenchmark::connect_disconnect_benchmark_data()
     QTest::newRow("w unormalized signature/handle") << 4  << true;
     QTest::newRow("w function pointer/handle") << 5       << true;
     QTest::newRow("w functor/handle") << 6                << true;
+    QTest::newRow("w function pointer/first of 200 signals") << 7 << true;
+    QTest::newRow("w function pointer/last of 200 signals") << 8  << true;
+    QTest::newRow("w compile-time indices") << 9              << true;
 
 }
 
@@ -214,6 +268,27 @@ void connect_disconnect_benchmark()
                 QObject::disconnect(QObject::connect(&obj, &Object::signal5, functor));
             }
         } break;
+        case 7: {
+            ManySignalsW obj;
+            QBENCHMARK {
+                QObject::connect   (&obj, &ManySignalsW::signal000, &obj, &ManySignalsW::slot0);
+                QObject::disconnect(&obj, &ManySignalsW::signal000, &obj, &ManySignalsW::slot0);
+            }
+        } break;
+        case 8: {
+            ManySignalsW obj;
+            QBENCHMARK {
+                QObject::connect   (&obj, &ManySignalsW::signal199, &obj, &ManySignalsW::slot0);
+                QObject::disconnect(&obj, &ManySignalsW::signal199, &obj, &ManySignalsW::slot0);
+            }
+        } break;
+        case 9: {
+            ObjectW obj;
+            QBENCHMARK {
+                W_CONNECT   (&obj, &ObjectW::signal5, &obj, &ObjectW::slot5);
+                W_DISCONNECT(&obj, &ObjectW::signal5, &obj, &ObjectW::slot5);
+            }
+        } break;
     }
 }
 
@@ -224,6 +299,548 @@ void QObjectBenchmark::connect_disconnect_benchmark()
     else ::connect_disconnect_benchmark<Object>();
 }
 
+void QObjectBenchmark::payload_signal_benchmark_data()
+{
+    QTest::addColumn<bool>("w");
+    QTest::addColumn<bool>("queued");
+
+    QTest::newRow("1MB payload") << false << false;
+    QTest::newRow("1MB payload/queued") << false << true;
+    QTest::newRow("w 1MB payload") << true << false;
+    QTest::newRow("w 1MB payload/queued") << true << true;
+}
+
+template<typename Object>
+void payload_signal_benchmark()
+{
+    QFETCH(bool, queued);
+    qRegisterMetaType<Payload>();
+    Object obj;
+    QObject::connect(&obj, &Object::payloadSignal, &obj, &Object::payloadSlot,
+                     queued ? Qt::QueuedConnection : Qt::DirectConnection);
+    const Payload payload;
+    Payload::copies = 0;
+    int emissions = 0;
+    QBENCHMARK {
+        emit obj.payloadSignal(payload);
+        if (queued)
+            QCoreApplication::processEvents();
+        ++emissions;
+    }
+    // One copy is made by the caller, to pass the argument by value,
+    // and a queued connection copies it once more in the event
+    QCOMPARE(Payload::copies, emissions * (queued ? 2 : 1));
+}
+
+void QObjectBenchmark::payload_signal_benchmark()
+{
+    QFETCH(bool, w);
+    if (w) ::payload_signal_benchmark<ObjectW>();
+    else ::payload_signal_benchmark<Object>();
+}
+
+void QObjectBenchmark::invoke_method_benchmark_data()
+{
+    QTest::addColumn<QByteArray>("slot");
+
+    QTest::newRow("w first of 500 slots") << QByteArray("slot000()");
+    QTest::newRow("w last of 500 slots") << QByteArray("slot499()");
+}
+
+void QObjectBenchmark::invoke_method_benchmark()
+{
+    QFETCH(QByteArray, slot);
+    ManySlotsW obj;
+    const int idx = obj.metaObject()->indexOfSlot(slot.constData());
+    QVERIFY(idx >= 0);
+    void *argv[] = { nullptr };
+    QBENCHMARK {
+        QMetaObject::metacall(&obj, QMetaObject::InvokeMetaMethod, idx, argv);
+    }
+}
+
+void QObjectBenchmark::metacast_benchmark_data()
+{
+    QTest::addColumn<int>("type");
+
+    QTest::newRow("w class name of the leaf") << 0;
+    QTest::newRow("w class name of the root") << 1;
+    QTest::newRow("w qobject_cast to interface") << 2;
+    QTest::newRow("w interface from a copied IID") << 3;
+    QTest::newRow("w no match") << 4;
+}
+
+void QObjectBenchmark::metacast_benchmark()
+{
+    QFETCH(int, type);
+    DeepW7 obj;
+    QObject *o = &obj;
+    const QByteArray iid = qobject_interface_iid<PluginInterfaceC *>();
+    switch (type) {
+        case 0:
+            QBENCHMARK { o->qt_metacast("DeepW7"); }
+            break;
+        case 1:
+            QBENCHMARK { o->qt_metacast("DeepW0"); }
+            break;
+        case 2:
+            QBENCHMARK { qobject_cast<PluginInterfaceC *>(o); }
+            break;
+        case 3:
+            QBENCHMARK { o->qt_metacast(iid.constData()); }
+            break;
+        case 4:
+            QBENCHMARK { o->qt_metacast("com.woboq.verdigris.benchmark.PluginInterfaceD/1.0"); }
+            break;
+    }
+}
+
+void QObjectBenchmark::create_instance_benchmark_data()
+{
+    QTest::addColumn<int>("type");
+
+    QTest::newRow("w newInstance first constructor") << 0;
+    QTest::newRow("w newInstance last constructor") << 1;
+    QTest::newRow("w constructInPlace last constructor") << 2;
+    QTest::newRow("w pooled createInstance last constructor") << 3;
+}
+
+// Fixed size blocks taken from a free list, to construct objects without the heap
+struct ObjectPool {
+    std::vector<void *> freeBlocks;
+    explicit ObjectPool(std::size_t blockSize, int count) {
+        for (int i = 0; i < count; ++i)
+            freeBlocks.push_back(::operator new(blockSize));
+    }
+    ~ObjectPool() {
+        for (void *b : freeBlocks)
+            ::operator delete(b);
+    }
+};
+template<typename T> struct PoolAllocator {
+    using value_type = T;
+    ObjectPool *pool;
+    explicit PoolAllocator(ObjectPool *p) : pool(p) {}
+    template<typename U> PoolAllocator(const PoolAllocator<U> &o) : pool(o.pool) {}
+    T *allocate(std::size_t) {
+        void *b = pool->freeBlocks.back();
+        pool->freeBlocks.pop_back();
+        return static_cast<T *>(b);
+    }
+    void deallocate(T *p, std::size_t) { pool->freeBlocks.push_back(p); }
+};
+
+void QObjectBenchmark::create_instance_benchmark()
+{
+    QFETCH(int, type);
+    const QMetaObject *mo = &ConstructibleW::staticMetaObject;
+    int a = 1, b = 2, c = 3, d = 4, e = 5, f = 6, g = 7;
+    void *args[] = { nullptr, &a, &b, &c, &d, &e, &f, &g };
+    switch (type) {
+        case 0:
+            QBENCHMARK { delete mo->newInstance(); }
+            break;
+        case 1:
+            QBENCHMARK {
+                delete mo->newInstance(Q_ARG(int, a), Q_ARG(int, b), Q_ARG(int, c), Q_ARG(int, d),
+                                       Q_ARG(int, e), Q_ARG(int, f), Q_ARG(int, g));
+            }
+            break;
+        case 2: {
+            alignas(ConstructibleW) char storage[sizeof(ConstructibleW)];
+            QBENCHMARK {
+                w_cpp::constructInPlace<ConstructibleW>(storage, 7, args)->~ConstructibleW();
+            }
+            break;
+        }
+        case 3: {
+            ObjectPool pool(sizeof(ConstructibleW), 1);
+            PoolAllocator<ConstructibleW> allocator(&pool);
+            QBENCHMARK {
+                w_cpp::destroyInstance(allocator, w_cpp::createInstance<ConstructibleW>(allocator, 7, args));
+            }
+            break;
+        }
+    }
+}
+
+void QObjectBenchmark::property_access_benchmark_data()
+{
+    QTest::addColumn<int>("type");
+
+    QTest::newRow("w QObject::setProperty") << 0;
+    QTest::newRow("w QObject::property") << 1;
+    QTest::newRow("w w_cpp::setProperty") << 2;
+    QTest::newRow("w w_cpp::getProperty") << 3;
+}
+
+void QObjectBenchmark::property_access_benchmark()
+{
+    QFETCH(int, type);
+    PropertyW obj;
+    constexpr int opacity = w_cpp::propertyIndex<PropertyW>("opacity");
+    double v = 0;
+    switch (type) {
+        case 0:
+            QBENCHMARK { obj.setProperty("opacity", v += 1); }
+            break;
+        case 1:
+            QBENCHMARK { v += obj.property("opacity").toDouble(); }
+            break;
+        case 2:
+            QBENCHMARK { w_cpp::setProperty<PropertyW, opacity>(&obj, v += 1); }
+            break;
+        case 3:
+            QBENCHMARK { v += w_cpp::getProperty<PropertyW, opacity>(&obj); }
+            break;
+    }
+    QVERIFY(v > 0);
+}
+
+void QObjectBenchmark::property_copy_benchmark_data()
+{
+    QTest::addColumn<int>("type");
+    QTest::addColumn<int>("copies"); // expected copies of the payload per access
+
+    // A getter or a setter taking its argument by value needs one copy, unless the value is a
+    // temporary. Going through QVariant adds the copy into or out of the QVariant.
+    QTest::newRow("w QObject::setProperty") << 0 << 2;
+    QTest::newRow("w QObject::property") << 1 << 2;
+    QTest::newRow("w w_cpp::setProperty") << 2 << 1;
+    QTest::newRow("w w_cpp::setProperty/temporary") << 3 << 0;
+    QTest::newRow("w w_cpp::getProperty") << 4 << 1;
+}
+
+void QObjectBenchmark::property_copy_benchmark()
+{
+    QFETCH(int, type);
+    QFETCH(int, copies);
+    PayloadPropertyW obj;
+    const MovablePayload payload;
+    const QVariant variant = QVariant::fromValue(payload);
+    MovablePayload::copies = 0;
+    int accesses = 0;
+    switch (type) {
+        case 0:
+            QBENCHMARK { obj.setProperty("payload", variant); ++accesses; }
+            break;
+        case 1:
+            QBENCHMARK {
+                // not value() on the temporary, which may move out of it depending on the Qt version
+                const QVariant read = obj.property("payload");
+                accesses += int(read.value<MovablePayload>().data.size() > 0);
+            }
+            break;
+        case 2:
+            QBENCHMARK { w_cpp::setProperty<PayloadPropertyW, 0>(&obj, payload); ++accesses; }
+            break;
+        case 3:
+            QBENCHMARK { w_cpp::setProperty<PayloadPropertyW, 0>(&obj, MovablePayload()); ++accesses; }
+            break;
+        case 4:
+            QBENCHMARK { accesses += int(w_cpp::getProperty<PayloadPropertyW, 0>(&obj).data.size() > 0); }
+            break;
+    }
+    QVERIFY(accesses > 0);
+    QCOMPARE(MovablePayload::copies, copies * accesses);
+}
+
+void QObjectBenchmark::property_chain_benchmark_data()
+{
+    QTest::addColumn<bool>("bindings"); // W_BINDABLE bindings instead of notify signals
+    QTest::addColumn<int>("writes"); // writes of the first link for each read of the last one
+
+    QTest::newRow("w notify chain/1 write") << false << 1;
+    QTest::newRow("w notify chain/10 writes") << false << 10;
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+    QTest::newRow("w binding chain/1 write") << true << 1;
+    QTest::newRow("w binding chain/10 writes") << true << 10;
+#endif
+}
+
+// A chain of 100 properties, each one being the previous one plus one
+void QObjectBenchmark::property_chain_benchmark()
+{
+    QFETCH(bool, bindings);
+    QFETCH(int, writes);
+    constexpr int depth = 100;
+    int v = 0;
+    int last = 0;
+    if (!bindings) {
+        std::vector<std::unique_ptr<NotifyChainLinkW>> chain;
+        for (int i = 0; i < depth; ++i) {
+            chain.emplace_back(new NotifyChainLinkW);
+            if (i > 0) {
+                NotifyChainLinkW *prev = chain[i - 1].get();
+                NotifyChainLinkW *next = chain[i].get();
+                QObject::connect(prev, &NotifyChainLinkW::valueChanged, next,
+                                 [prev, next] { next->setValue(prev->value() + 1); });
+            }
+        }
+        QBENCHMARK {
+            for (int i = 0; i < writes; ++i)
+                chain.front()->setValue(++v);
+            last = chain.back()->value();
+        }
+    } else {
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+        std::vector<std::unique_ptr<BindableChainLinkW>> chain;
+        for (int i = 0; i < depth; ++i) {
+            chain.emplace_back(new BindableChainLinkW);
+            if (i > 0) {
+                BindableChainLinkW *prev = chain[i - 1].get();
+                chain[i]->bindableValue().setBinding([prev] { return prev->value() + 1; });
+            }
+        }
+        QBENCHMARK {
+            for (int i = 0; i < writes; ++i)
+                chain.front()->setValue(++v);
+            last = chain.back()->value();
+        }
+#endif
+    }
+    QCOMPARE(last, v + depth - 1);
+}
+
+void QObjectBenchmark::index_of_property_benchmark_data()
+{
+    QTest::addColumn<QByteArray>("name");
+    QTest::addColumn<bool>("perfectHash"); // w_cpp::indexOfProperty instead of QMetaObject::indexOfProperty
+
+    QTest::newRow("w first of 500 properties") << QByteArray("prop000") << false;
+    QTest::newRow("w last of 500 properties") << QByteArray("prop499") << false;
+    QTest::newRow("w property of QObject") << QByteArray("objectName") << false;
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+    QTest::newRow("w perfect hash first of 500 properties") << QByteArray("prop000") << true;
+    QTest::newRow("w perfect hash last of 500 properties") << QByteArray("prop499") << true;
+    QTest::newRow("w perfect hash property of QObject") << QByteArray("objectName") << true;
+#endif
+}
+
+void QObjectBenchmark::index_of_property_benchmark()
+{
+    QFETCH(QByteArray, name);
+    QFETCH(bool, perfectHash);
+    const QMetaObject *mo = &ManyPropertiesW::staticMetaObject;
+    const int expected = mo->indexOfProperty(name.constData());
+    QVERIFY(expected >= 0);
+    int idx = -1;
+    if (!perfectHash) {
+        QBENCHMARK { idx = mo->indexOfProperty(name.constData()); }
+    } else {
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+        QBENCHMARK { idx = w_cpp::indexOfProperty(mo, name); }
+#endif
+    }
+    QCOMPARE(idx, expected);
+}
+
+void QObjectBenchmark::index_of_method_benchmark_data()
+{
+    QTest::addColumn<QByteArray>("signature");
+    QTest::addColumn<bool>("perfectHash"); // w_cpp::indexOfMethod instead of QMetaObject::indexOfMethod
+
+    QTest::newRow("w first of 500 slots") << QByteArray("slot000()") << false;
+    QTest::newRow("w last of 500 slots") << QByteArray("slot499()") << false;
+    QTest::newRow("w slot of QObject") << QByteArray("deleteLater()") << false;
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+    QTest::newRow("w perfect hash first of 500 slots") << QByteArray("slot000()") << true;
+    QTest::newRow("w perfect hash last of 500 slots") << QByteArray("slot499()") << true;
+    QTest::newRow("w perfect hash slot of QObject") << QByteArray("deleteLater()") << true;
+#endif
+}
+
+void QObjectBenchmark::index_of_method_benchmark()
+{
+    QFETCH(QByteArray, signature);
+    QFETCH(bool, perfectHash);
+    const QMetaObject *mo = &ManySlotsW::staticMetaObject;
+    const int expected = mo->indexOfMethod(signature.constData());
+    QVERIFY(expected >= 0);
+    int idx = -1;
+    if (!perfectHash) {
+        QBENCHMARK { idx = mo->indexOfMethod(signature.constData()); }
+    } else {
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+        QBENCHMARK { idx = w_cpp::indexOfMethod(mo, signature); }
+#endif
+    }
+    QCOMPARE(idx, expected);
+}
+
+void QObjectBenchmark::typed_invoke_benchmark_data()
+{
+    QTest::addColumn<bool>("typed"); // w_cpp::invoke instead of QMetaObject::invokeMethod by name
+    QTest::addColumn<bool>("queued");
+
+    QTest::newRow("w invokeMethod by name") << false << false;
+    QTest::newRow("w invokeMethod by name/queued") << false << true;
+#if __cplusplus > 201700L && !defined(Q_CC_MSVC)
+    QTest::newRow("w typed invoke") << true << false;
+    QTest::newRow("w typed invoke/queued") << true << true;
+#endif
+}
+
+void QObjectBenchmark::typed_invoke_benchmark()
+{
+    QFETCH(bool, typed);
+    QFETCH(bool, queued);
+    const Qt::ConnectionType type = queued ? Qt::QueuedConnection : Qt::DirectConnection;
+    PropertyW obj;
+    double v = 0;
+    if (!typed) {
+        QBENCHMARK {
+            QMetaObject::invokeMethod(&obj, "setOpacity", type, Q_ARG(double, v += 1));
+            if (queued)
+                QCoreApplication::processEvents();
+        }
+    } else {
+#if __cplusplus > 201700L && !defined(Q_CC_MSVC)
+        QBENCHMARK {
+            w_cpp::invoke<&PropertyW::setOpacity>(&obj, type, v += 1);
+            if (queued)
+                QCoreApplication::processEvents();
+        }
+#endif
+    }
+    QCOMPARE(obj.opacity(), v);
+}
+
+void QObjectBenchmark::static_connect_benchmark_data()
+{
+    QTest::addColumn<bool>("isStatic"); // W_STATIC_CONNECT instead of QObject::connect in the constructor
+    QTest::addColumn<bool>("construct"); // measure the construction and destruction instead of the emission
+
+    QTest::newRow("w connect in constructor/construct") << false << true;
+    QTest::newRow("w connect in constructor/emit") << false << false;
+    QTest::newRow("w static connect/construct") << true << true;
+    QTest::newRow("w static connect/emit") << true << false;
+}
+
+template<typename Object>
+void static_connect_benchmark()
+{
+    QFETCH(bool, construct);
+    int i = 0;
+    if (construct) {
+        QBENCHMARK {
+            Object obj;
+            emit obj.valueChanged(++i);
+        }
+    } else {
+        Object obj;
+        QBENCHMARK {
+            emit obj.valueChanged(++i);
+        }
+        QCOMPARE(obj.value, i);
+    }
+}
+
+void QObjectBenchmark::static_connect_benchmark()
+{
+    QFETCH(bool, isStatic);
+    if (isStatic) ::static_connect_benchmark<StaticConnectedW>();
+    else ::static_connect_benchmark<SelfConnectedW>();
+}
+
+void QObjectBenchmark::pooled_connect_benchmark_data()
+{
+    QTest::addColumn<bool>("pooled"); // w_cpp::connectPooled instead of QObject::connect
+    QTest::addColumn<int>("type"); // 0: connect and disconnect, 1: emit
+
+    QTest::newRow("w functor/handle") << false << 0;
+    QTest::newRow("w functor/emit") << false << 1;
+    QTest::newRow("w pooled functor/handle") << true << 0;
+    QTest::newRow("w pooled functor/emit") << true << 1;
+}
+
+void QObjectBenchmark::pooled_connect_benchmark()
+{
+    QFETCH(bool, pooled);
+    QFETCH(int, type);
+    ObjectW obj;
+    int count = 0;
+    auto functor = [&count] { ++count; };
+    auto connectDisconnect = [&] {
+        if (pooled)
+            w_cpp::disconnect(w_cpp::connectPooled(&obj, &ObjectW::signal5, functor));
+        else
+            QObject::disconnect(QObject::connect(&obj, &ObjectW::signal5, functor));
+    };
+    // the first pooled connection creates the connection of the dispatcher and fills the pool
+    connectDisconnect();
+    switch (type) {
+    case 0:
+        QBENCHMARK {
+            connectDisconnect();
+        }
+        break;
+    case 1:
+        if (pooled)
+            w_cpp::connectPooled(&obj, &ObjectW::signal5, functor);
+        else
+            QObject::connect(&obj, &ObjectW::signal5, functor);
+        QBENCHMARK {
+            emit obj.signal5();
+        }
+        QVERIFY(count > 0);
+        break;
+    }
+}
+
+void QObjectBenchmark::property_transaction_benchmark_data()
+{
+    QTest::addColumn<int>("mode"); // 0: no transaction, 1: PropertyTransaction, 2: with an aggregated signal
+
+    QTest::newRow("w notify each write") << 0;
+    QTest::newRow("w transaction") << 1;
+    QTest::newRow("w transaction/aggregated signal") << 2;
+}
+
+template<size_t... I>
+static void writeDocumentNode(DocumentNodeW *node, int value, std::index_sequence<I...>)
+{
+    int unused[] = { (w_cpp::setProperty<DocumentNodeW, int(I)>(node, value), 0)... };
+    Q_UNUSED(unused)
+}
+
+// Writes the 50 properties of 10000 objects, counting the calls of the code connected to their signals
+void QObjectBenchmark::property_transaction_benchmark()
+{
+    QFETCH(int, mode);
+    constexpr int objectCount = 10000;
+    std::vector<std::unique_ptr<DocumentNodeW>> nodes;
+    qint64 recomputations = 0;
+    auto recompute = [&recomputations] { ++recomputations; };
+    for (int i = 0; i < objectCount; ++i) {
+        nodes.emplace_back(new DocumentNodeW);
+        DocumentNodeW *node = nodes.back().get();
+        QObject::connect(node, &DocumentNodeW::group0Changed, recompute);
+        QObject::connect(node, &DocumentNodeW::group1Changed, recompute);
+        QObject::connect(node, &DocumentNodeW::group2Changed, recompute);
+        QObject::connect(node, &DocumentNodeW::group3Changed, recompute);
+        QObject::connect(node, &DocumentNodeW::group4Changed, recompute);
+        QObject::connect(node, &DocumentNodeW::propertiesChanged, recompute);
+    }
+    int value = 0;
+    qint64 recomputationsPerWrite = 0;
+    QBENCHMARK {
+        ++value;
+        recomputations = 0;
+        for (auto &node : nodes) {
+            if (mode == 0) {
+                writeDocumentNode(node.get(), value, std::make_index_sequence<50>{});
+            } else {
+                w_cpp::PropertyTransaction<DocumentNodeW> transaction(
+                    node.get(), mode == 2 ? &DocumentNodeW::propertiesChanged : nullptr);
+                writeDocumentNode(node.get(), value, std::make_index_sequence<50>{});
+            }
+        }
+        recomputationsPerWrite = recomputations / objectCount;
+    }
+    QCOMPARE(recomputationsPerWrite, mode == 0 ? 50 : mode == 1 ? 5 : 1);
+}
+
 QTEST_MAIN(QObjectBenchmark)
 
 #include "main.moc"
\ No newline at end of file
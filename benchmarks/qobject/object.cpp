@@ -27,6 +27,9 @@
 ****************************************************************************/
 #include "object.h"
 
+int Payload::copies = 0;
+int MovablePayload::copies = 0;
+
 void Object::emitSignal0()
 { emit signal0(); }
 void Object::emitSignal1()
@@ -83,3 +86,82 @@ void ObjectW::slot9()
 { }
 
 W_OBJECT_IMPL(ObjectW)
+
+void ObjectWSkip::emitSignal0()
+{ emit signal0(); }
+void ObjectWSkip::emitSignal1()
+{ emit signal1(); }
+
+void ObjectWSkip::slot0()
+{ }
+void ObjectWSkip::slot1()
+{ }
+void ObjectWSkip::slot2()
+{ }
+void ObjectWSkip::slot3()
+{ }
+void ObjectWSkip::slot4()
+{ }
+void ObjectWSkip::slot5()
+{ }
+void ObjectWSkip::slot6()
+{ }
+void ObjectWSkip::slot7()
+{ }
+void ObjectWSkip::slot8()
+{ }
+void ObjectWSkip::slot9()
+{ }
+
+W_OBJECT_IMPL(ObjectWSkip)
+
+void ObjectWOutlined::emitSignal0()
+{ emit signal0(); }
+void ObjectWOutlined::emitSignal1()
+{ emit signal1(); }
+
+void ObjectWOutlined::slot0()
+{ }
+void ObjectWOutlined::slot1()
+{ }
+void ObjectWOutlined::slot2()
+{ }
+void ObjectWOutlined::slot3()
+{ }
+void ObjectWOutlined::slot4()
+{ }
+void ObjectWOutlined::slot5()
+{ }
+void ObjectWOutlined::slot6()
+{ }
+void ObjectWOutlined::slot7()
+{ }
+void ObjectWOutlined::slot8()
+{ }
+void ObjectWOutlined::slot9()
+{ }
+
+W_OBJECT_IMPL(ObjectWOutlined)
+
+W_OBJECT_IMPL(ManySlotsW)
+W_OBJECT_IMPL(ManySignalsW)
+W_OBJECT_IMPL(ManyPropertiesW)
+W_OBJECT_IMPL(PropertyW)
+W_OBJECT_IMPL(ConstructibleW)
+W_OBJECT_IMPL(SelfConnectedW)
+W_OBJECT_IMPL(StaticConnectedW)
+W_OBJECT_IMPL(PayloadPropertyW)
+W_OBJECT_IMPL(NotifyChainLinkW)
+W_OBJECT_IMPL(DocumentNodeW)
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+W_OBJECT_IMPL(BindableChainLinkW)
+#endif
+
+W_OBJECT_IMPL(DeepW0)
+W_OBJECT_IMPL(DeepW1)
+W_OBJECT_IMPL(DeepW2)
+W_OBJECT_IMPL(DeepW3)
+W_OBJECT_IMPL(DeepW4)
+W_OBJECT_IMPL(DeepW5)
+W_OBJECT_IMPL(DeepW6)
+W_OBJECT_IMPL(DeepW7)
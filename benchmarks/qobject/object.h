@@ -30,6 +30,33 @@
 
 #include <qobject.h>
 #include "wobjectimpl.h"
+#include <vector>
+
+/// 1MB payload which counts its copies (each copy is an allocation)
+struct Payload
+{
+    static int copies;
+    std::vector<char> data = std::vector<char>(1024 * 1024);
+    Payload() = default;
+    Payload(const Payload &other) : data(other.data) { ++copies; }
+    Payload &operator=(const Payload &other) { data = other.data; ++copies; return *this; }
+};
+Q_DECLARE_METATYPE(Payload)
+W_REGISTER_ARGTYPE(Payload)
+
+/// Same as Payload, but movable (moving does not allocate)
+struct MovablePayload
+{
+    static int copies;
+    std::vector<char> data = std::vector<char>(1024 * 1024);
+    MovablePayload() = default;
+    MovablePayload(const MovablePayload &other) : data(other.data) { ++copies; }
+    MovablePayload(MovablePayload &&) = default;
+    MovablePayload &operator=(const MovablePayload &other) { data = other.data; ++copies; return *this; }
+    MovablePayload &operator=(MovablePayload &&) = default;
+};
+Q_DECLARE_METATYPE(MovablePayload)
+W_REGISTER_ARGTYPE(MovablePayload)
 
 class Object : public QObject
 {
@@ -48,6 +75,7 @@ signals:
     void signal7();
     void signal8();
     void signal9();
+    void payloadSignal(Payload p);
 public slots:
     void slot0();
     void slot1();
@@ -59,6 +87,7 @@ public slots:
     void slot7();
     void slot8();
     void slot9();
+    void payloadSlot(const Payload &) {}
 };
 
 class ObjectW : public QObject
@@ -78,6 +107,7 @@ public:
     void signal7() W_SIGNAL(signal7)
     void signal8() W_SIGNAL(signal8)
     void signal9() W_SIGNAL(signal9)
+    void payloadSignal(Payload p) W_SIGNAL(payloadSignal, p)
 
 //public slots:
     void slot0(); W_SLOT(slot0)
@@ -90,8 +120,296 @@ public:
     void slot7(); W_SLOT(slot7)
     void slot8(); W_SLOT(slot8)
     void slot9(); W_SLOT(slot9)
+    void payloadSlot(const Payload &) {} W_SLOT(payloadSlot)
 
 };
 
+// Same as ObjectW, with W_SKIP_UNCONNECTED_SIGNALS
+class ObjectWSkip : public QObject
+{
+    W_OBJECT(ObjectWSkip)
+    W_SKIP_UNCONNECTED_SIGNALS
+public:
+    void emitSignal0();
+    void emitSignal1();
+//signals:
+    void signal0() W_SIGNAL(signal0)
+    void signal1() W_SIGNAL(signal1)
+    void signal2() W_SIGNAL(signal2)
+    void signal3() W_SIGNAL(signal3)
+    void signal4() W_SIGNAL(signal4)
+    void signal5() W_SIGNAL(signal5)
+    void signal6() W_SIGNAL(signal6)
+    void signal7() W_SIGNAL(signal7)
+    void signal8() W_SIGNAL(signal8)
+    void signal9() W_SIGNAL(signal9)
+
+//public slots:
+    void slot0(); W_SLOT(slot0)
+    void slot1(); W_SLOT(slot1)
+    void slot2(); W_SLOT(slot2)
+    void slot3(); W_SLOT(slot3)
+    void slot4(); W_SLOT(slot4)
+    void slot5(); W_SLOT(slot5)
+    void slot6(); W_SLOT(slot6)
+    void slot7(); W_SLOT(slot7)
+    void slot8(); W_SLOT(slot8)
+    void slot9(); W_SLOT(slot9)
+
+};
+
+class ObjectWOutlined : public QObject
+{
+    W_OBJECT(ObjectWOutlined)
+    W_OUTLINE_SIGNALS
+public:
+    void emitSignal0();
+    void emitSignal1();
+//signals:
+    void signal0() W_SIGNAL(signal0)
+    void signal1() W_SIGNAL(signal1)
+    void signal2() W_SIGNAL(signal2)
+    void signal3() W_SIGNAL(signal3)
+    void signal4() W_SIGNAL(signal4)
+    void signal5() W_SIGNAL(signal5)
+    void signal6() W_SIGNAL(signal6)
+    void signal7() W_SIGNAL(signal7)
+    void signal8() W_SIGNAL(signal8)
+    void signal9() W_SIGNAL(signal9)
+
+//public slots:
+    void slot0(); W_SLOT(slot0)
+    void slot1(); W_SLOT(slot1)
+    void slot2(); W_SLOT(slot2)
+    void slot3(); W_SLOT(slot3)
+    void slot4(); W_SLOT(slot4)
+    void slot5(); W_SLOT(slot5)
+    void slot6(); W_SLOT(slot6)
+    void slot7(); W_SLOT(slot7)
+    void slot8(); W_SLOT(slot8)
+    void slot9(); W_SLOT(slot9)
+
+};
+
+struct PluginInterfaceA { virtual ~PluginInterfaceA() = default; };
+struct PluginInterfaceB { virtual ~PluginInterfaceB() = default; };
+struct PluginInterfaceC { virtual ~PluginInterfaceC() = default; };
+Q_DECLARE_INTERFACE(PluginInterfaceA, "com.woboq.verdigris.benchmark.PluginInterfaceA/1.0")
+Q_DECLARE_INTERFACE(PluginInterfaceB, "com.woboq.verdigris.benchmark.PluginInterfaceB/1.0")
+Q_DECLARE_INTERFACE(PluginInterfaceC, "com.woboq.verdigris.benchmark.PluginInterfaceC/1.0")
+
+// 8 levels deep hierarchy, the root implements three interfaces
+class DeepW0 : public QObject, public PluginInterfaceA, public PluginInterfaceB, public PluginInterfaceC
+{
+    W_OBJECT(DeepW0)
+    W_INTERFACE(PluginInterfaceA)
+    W_INTERFACE(PluginInterfaceB)
+    W_INTERFACE(PluginInterfaceC)
+};
+class DeepW1 : public DeepW0 { W_OBJECT(DeepW1) };
+class DeepW2 : public DeepW1 { W_OBJECT(DeepW2) };
+class DeepW3 : public DeepW2 { W_OBJECT(DeepW3) };
+class DeepW4 : public DeepW3 { W_OBJECT(DeepW4) };
+class DeepW5 : public DeepW4 { W_OBJECT(DeepW5) };
+class DeepW6 : public DeepW5 { W_OBJECT(DeepW6) };
+class DeepW7 : public DeepW6 { W_OBJECT(DeepW7) };
+
+#define MANY_SLOT(N) void slot##N() {} W_SLOT(slot##N)
+#define MANY_SLOTS_10(P) \
+    MANY_SLOT(P##0) MANY_SLOT(P##1) MANY_SLOT(P##2) MANY_SLOT(P##3) MANY_SLOT(P##4) \
+    MANY_SLOT(P##5) MANY_SLOT(P##6) MANY_SLOT(P##7) MANY_SLOT(P##8) MANY_SLOT(P##9)
+#define MANY_SLOTS_100(P) \
+    MANY_SLOTS_10(P##0) MANY_SLOTS_10(P##1) MANY_SLOTS_10(P##2) MANY_SLOTS_10(P##3) MANY_SLOTS_10(P##4) \
+    MANY_SLOTS_10(P##5) MANY_SLOTS_10(P##6) MANY_SLOTS_10(P##7) MANY_SLOTS_10(P##8) MANY_SLOTS_10(P##9)
+
+// 500 slots: slot000 ... slot499
+class ManySlotsW : public QObject
+{
+    W_OBJECT(ManySlotsW)
+    W_NAME_INDEX // for w_cpp::indexOfMethod
+public:
+    MANY_SLOTS_100(0)
+    MANY_SLOTS_100(1)
+    MANY_SLOTS_100(2)
+    MANY_SLOTS_100(3)
+    MANY_SLOTS_100(4)
+};
+
+#define MANY_SIGNAL(N) void signal##N() W_SIGNAL(signal##N)
+#define MANY_SIGNALS_10(P) \
+    MANY_SIGNAL(P##0) MANY_SIGNAL(P##1) MANY_SIGNAL(P##2) MANY_SIGNAL(P##3) MANY_SIGNAL(P##4) \
+    MANY_SIGNAL(P##5) MANY_SIGNAL(P##6) MANY_SIGNAL(P##7) MANY_SIGNAL(P##8) MANY_SIGNAL(P##9)
+#define MANY_SIGNALS_100(P) \
+    MANY_SIGNALS_10(P##0) MANY_SIGNALS_10(P##1) MANY_SIGNALS_10(P##2) MANY_SIGNALS_10(P##3) MANY_SIGNALS_10(P##4) \
+    MANY_SIGNALS_10(P##5) MANY_SIGNALS_10(P##6) MANY_SIGNALS_10(P##7) MANY_SIGNALS_10(P##8) MANY_SIGNALS_10(P##9)
+
+// 200 signals: signal000 ... signal199
+class ManySignalsW : public QObject
+{
+    W_OBJECT(ManySignalsW)
+public:
+    MANY_SIGNALS_100(0)
+    MANY_SIGNALS_100(1)
+
+    void slot0() {}
+    W_SLOT(slot0)
+};
+
+class PropertyW : public QObject
+{
+    W_OBJECT(PropertyW)
+public:
+    double m_opacity = 1;
+    double opacity() const { return m_opacity; }
+    void setOpacity(double o) { m_opacity = o; }
+    W_SLOT(setOpacity)
+    W_PROPERTY(double, opacity READ opacity WRITE setOpacity)
+};
+
+// 8 constructors, taking from 0 to 7 int
+class ConstructibleW : public QObject
+{
+    W_OBJECT(ConstructibleW)
+public:
+    int sum = 0;
+    ConstructibleW() {}
+    W_CONSTRUCTOR()
+    ConstructibleW(int a) : sum(a) {}
+    W_CONSTRUCTOR(int)
+    ConstructibleW(int a, int b) : sum(a + b) {}
+    W_CONSTRUCTOR(int, int)
+    ConstructibleW(int a, int b, int c) : sum(a + b + c) {}
+    W_CONSTRUCTOR(int, int, int)
+    ConstructibleW(int a, int b, int c, int d) : sum(a + b + c + d) {}
+    W_CONSTRUCTOR(int, int, int, int)
+    ConstructibleW(int a, int b, int c, int d, int e) : sum(a + b + c + d + e) {}
+    W_CONSTRUCTOR(int, int, int, int, int)
+    ConstructibleW(int a, int b, int c, int d, int e, int f) : sum(a + b + c + d + e + f) {}
+    W_CONSTRUCTOR(int, int, int, int, int, int)
+    ConstructibleW(int a, int b, int c, int d, int e, int f, int g) : sum(a + b + c + d + e + f + g) {}
+    W_CONSTRUCTOR(int, int, int, int, int, int, int)
+};
+
+#define MANY_PROPERTY(N) int m_prop##N = 0; W_PROPERTY(int, prop##N MEMBER m_prop##N)
+#define MANY_PROPERTIES_10(P) \
+    MANY_PROPERTY(P##0) MANY_PROPERTY(P##1) MANY_PROPERTY(P##2) MANY_PROPERTY(P##3) MANY_PROPERTY(P##4) \
+    MANY_PROPERTY(P##5) MANY_PROPERTY(P##6) MANY_PROPERTY(P##7) MANY_PROPERTY(P##8) MANY_PROPERTY(P##9)
+#define MANY_PROPERTIES_100(P) \
+    MANY_PROPERTIES_10(P##0) MANY_PROPERTIES_10(P##1) MANY_PROPERTIES_10(P##2) MANY_PROPERTIES_10(P##3) MANY_PROPERTIES_10(P##4) \
+    MANY_PROPERTIES_10(P##5) MANY_PROPERTIES_10(P##6) MANY_PROPERTIES_10(P##7) MANY_PROPERTIES_10(P##8) MANY_PROPERTIES_10(P##9)
+
+// 500 properties: prop000 ... prop499
+class ManyPropertiesW : public QObject
+{
+    W_OBJECT(ManyPropertiesW)
+    W_NAME_INDEX // for w_cpp::indexOfProperty
+public:
+    MANY_PROPERTIES_100(0)
+    MANY_PROPERTIES_100(1)
+    MANY_PROPERTIES_100(2)
+    MANY_PROPERTIES_100(3)
+    MANY_PROPERTIES_100(4)
+};
+
+#undef MANY_PROPERTIES_100
+#undef MANY_PROPERTIES_10
+#undef MANY_PROPERTY
+#undef MANY_SIGNALS_100
+#undef MANY_SIGNALS_10
+#undef MANY_SIGNAL
+#undef MANY_SLOTS_100
+// Connects its signal to its slot in every constructor
+class SelfConnectedW : public QObject
+{
+    W_OBJECT(SelfConnectedW)
+public:
+    int value = 0;
+    SelfConnectedW() { connect(this, &SelfConnectedW::valueChanged, this, &SelfConnectedW::setValue); }
+    void valueChanged(int v) W_SIGNAL(valueChanged, v)
+    void setValue(int v) { value = v; }
+    W_SLOT(setValue)
+};
+
+// Same, with W_STATIC_CONNECT
+class StaticConnectedW : public QObject
+{
+    W_OBJECT(StaticConnectedW)
+public:
+    int value = 0;
+    void valueChanged(int v) W_SIGNAL(valueChanged, v)
+    void setValue(int v) { value = v; }
+    W_SLOT(setValue)
+    W_STATIC_CONNECT(valueChanged, setValue)
+};
+
+// A property with a getter returning by value and a setter taking its argument by value
+class PayloadPropertyW : public QObject
+{
+    W_OBJECT(PayloadPropertyW)
+public:
+    MovablePayload m_payload;
+    MovablePayload payload() const { return m_payload; }
+    void setPayload(MovablePayload p) { m_payload = std::move(p); }
+    W_PROPERTY(MovablePayload, payload READ payload WRITE setPayload)
+};
+
+// A link of a dependency chain, its value is updated from the notify signal of the previous link
+class NotifyChainLinkW : public QObject
+{
+    W_OBJECT(NotifyChainLinkW)
+public:
+    int m_value = 0;
+    int value() const { return m_value; }
+    void setValue(int v) {
+        if (v == m_value)
+            return;
+        m_value = v;
+        emit valueChanged();
+    }
+    void valueChanged() W_SIGNAL(valueChanged)
+    W_PROPERTY(int, value READ value WRITE setValue NOTIFY valueChanged)
+};
+
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+// Same, with a binding on the value of the previous link
+class BindableChainLinkW : public QObject
+{
+    W_OBJECT(BindableChainLinkW)
+public:
+    int value() const { return m_value; }
+    void setValue(int v) { m_value = v; }
+    QBindable<int> bindableValue() { return &m_value; }
+    void valueChanged() W_SIGNAL(valueChanged)
+    Q_OBJECT_BINDABLE_PROPERTY(BindableChainLinkW, int, m_value, &BindableChainLinkW::valueChanged)
+    W_PROPERTY(int, value READ value WRITE setValue NOTIFY valueChanged BINDABLE bindableValue)
+};
+#endif
+
+// A node of a document with 50 properties in 5 groups, each group having its notify signal
+#define NODE_PROPERTY(G, N) int m_prop##G##N = 0; W_PROPERTY(int, prop##G##N MEMBER m_prop##G##N NOTIFY group##G##Changed)
+#define NODE_GROUP(G) \
+    void group##G##Changed() W_SIGNAL(group##G##Changed) \
+    NODE_PROPERTY(G, 0) NODE_PROPERTY(G, 1) NODE_PROPERTY(G, 2) NODE_PROPERTY(G, 3) NODE_PROPERTY(G, 4) \
+    NODE_PROPERTY(G, 5) NODE_PROPERTY(G, 6) NODE_PROPERTY(G, 7) NODE_PROPERTY(G, 8) NODE_PROPERTY(G, 9)
+
+class DocumentNodeW : public QObject
+{
+    W_OBJECT(DocumentNodeW)
+public:
+    void propertiesChanged(const QBitArray &changed) W_SIGNAL(propertiesChanged, changed)
+    NODE_GROUP(0)
+    NODE_GROUP(1)
+    NODE_GROUP(2)
+    NODE_GROUP(3)
+    NODE_GROUP(4)
+    W_TRACK_PROPERTY_CHANGES
+};
+
+#undef NODE_GROUP
+#undef NODE_PROPERTY
+
+#undef MANY_SLOTS_10
+#undef MANY_SLOT
+
 
 #endif // OBJECT_H
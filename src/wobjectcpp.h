@@ -102,10 +102,11 @@ using w_internal::enum_sequence;
 /// * .setMember(M) - set the class attribute to read and write the value of the property
 /// * .setNotify(F) - set the member function that represents the changed signal for the property
 /// * .setReset(F) - set the member function that resets the property value to it's default
+/// * .setBindable(F) - set the member function that returns the QBindable of the property (Qt 6)
 /// * .addFlag<F>() - add one or multiple flags for the property
 template<typename T>
 constexpr auto makeProperty(StringView name, StringView type) {
-    return w_internal::MetaPropertyInfo<T>{ name, type, {}, {}, {}, {}, {} };
+    return w_internal::MetaPropertyInfo<T>{ name, type, {}, {}, {}, {}, {}, {} };
 }
 
 /// create a builder for a signal description
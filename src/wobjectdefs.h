@@ -26,6 +26,10 @@
 
 #include <QtCore/qobjectdefs.h>
 #include <QtCore/qmetatype.h>
+#include <QtCore/qalgorithms.h>
+#include <atomic>
+#include <memory>
+#include <tuple>
 #include <utility>
 
 #define W_VERSION 0x010200
@@ -239,9 +243,16 @@ enum class PropertyFlags  {
     User = 0x00100000,
     ResolveUser = 0x00200000,
     Notify = 0x00400000,
-    Revisioned = 0x00800000
+    Revisioned = 0x00800000,
+    Required = 0x01000000,
+    Bindable = 0x02000000,
+
+    // Only used by verdigris, not written in the meta object
+    Cached = 0x20000000, // The result of the getter is kept until the NOTIFY signal is emitted
+    NoCompare = 0x40000000 // Do not compare a MEMBER with the value written to it
 };
 constexpr uint operator|(uint a, PropertyFlags b) { return a | uint(b); }
+constexpr uint verdigrisOnlyPropertyFlags = uint(PropertyFlags::Cached) | uint(PropertyFlags::NoCompare);
 
 template <int N> struct W_MethodFlags { static constexpr int value = N; };
 constexpr W_MethodFlags<0> W_EmptyFlag{};
@@ -285,8 +296,11 @@ constexpr w_internal::W_MethodFlags<0x10> W_Compat{};
 constexpr w_internal::W_MethodFlags<0x40> W_Scriptable{};
 constexpr struct {} W_Notify{};
 constexpr struct {} W_Reset{};
+constexpr struct {} W_Bindable{};
 constexpr std::integral_constant<int, int(w_internal::PropertyFlags::Constant)> W_Constant{};
 constexpr std::integral_constant<int, int(w_internal::PropertyFlags::Final)> W_Final{};
+constexpr std::integral_constant<int, int(w_internal::PropertyFlags::NoCompare)> W_NoCompare{};
+constexpr std::integral_constant<int, int(w_internal::PropertyFlags::Cached)> W_Cached{};
 
 namespace w_internal {
 
@@ -335,6 +349,30 @@ makeMetaSignalInfo(F f, StringView name, IntegralConstant, const ParamTypes &par
                     const ParamNames &paramNames, W_MethodFlags<Flags>...)
 { return { f, name, paramTypes, paramNames }; }
 
+/// Holds information about a connection declared with W_STATIC_CONNECT: 'slot' is called when the
+/// signal named 'signalName', of type SignalF, is emitted
+template<typename SignalF, typename SlotF>
+struct MetaStaticConnectionInfo {
+    using Signal = SignalF;
+    StringView signalName;
+    SlotF slot;
+};
+
+// Called from the W_STATIC_CONNECT macro of the class Obj
+template<typename Obj, typename SignalF, typename SlotF>
+constexpr MetaStaticConnectionInfo<SignalF, SlotF>
+makeMetaStaticConnectionInfo(SignalF, StringView signalName, SlotF slot) {
+    using SignalType = QtPrivate::FunctionPointer<SignalF>;
+    using SlotType = QtPrivate::FunctionPointer<SlotF>;
+    static_assert(std::is_same<typename SignalType::Object, Obj>::value,
+                  "W_STATIC_CONNECT only works with the signals declared in the class itself, not with the ones of its base classes.");
+    static_assert(int(SignalType::ArgumentCount) >= int(SlotType::ArgumentCount),
+                  "The slot requires more arguments than the signal provides.");
+    static_assert((QtPrivate::CheckCompatibleArguments<typename SignalType::Arguments, typename SlotType::Arguments>::value),
+                  "Signal and slot arguments are not compatible.");
+    return { signalName, slot };
+}
+
 /// Holds information about a constructor
 template<typename... Args>
 struct MetaConstructorInfo {
@@ -354,8 +392,8 @@ struct Empty{
 };
 
 /// Holds information about a property
-template<typename Type, typename Getter = Empty, typename Setter = Empty,
-          typename Member = Empty, typename Notify = Empty, typename Reset = Empty, int Flags = 0>
+template<typename Type, typename Getter = Empty, typename Setter = Empty, typename Member = Empty,
+          typename Notify = Empty, typename Reset = Empty, typename Bindable = Empty, int Flags = 0>
 struct MetaPropertyInfo {
     using PropertyType = Type;
     StringView name;
@@ -365,37 +403,43 @@ struct MetaPropertyInfo {
     Member member;
     Notify notify;
     Reset reset;
+    Bindable bindable;
     static constexpr uint flags = Flags;
 
     template <typename S> constexpr auto setGetter(const S&s) const {
-        return MetaPropertyInfo<Type, S, Setter, Member, Notify, Reset,
+        return MetaPropertyInfo<Type, S, Setter, Member, Notify, Reset, Bindable,
                                 Flags | PropertyFlags::Readable>
-        {name, typeStr, s, setter, member, notify, reset};
+        {name, typeStr, s, setter, member, notify, reset, bindable};
     }
     template <typename S> constexpr auto setSetter(const S&s) const {
-        return MetaPropertyInfo<Type, Getter, S, Member, Notify, Reset,
+        return MetaPropertyInfo<Type, Getter, S, Member, Notify, Reset, Bindable,
                                 Flags | PropertyFlags::Writable>
-        {name, typeStr, getter, s, member, notify, reset};
+        {name, typeStr, getter, s, member, notify, reset, bindable};
     }
     template <typename S> constexpr auto setMember(const S&s) const {
-        return MetaPropertyInfo<Type, Getter, Setter, S, Notify, Reset,
+        return MetaPropertyInfo<Type, Getter, Setter, S, Notify, Reset, Bindable,
                                 Flags | PropertyFlags::Writable | PropertyFlags::Readable>
-        {name, typeStr, getter, setter, s, notify, reset};
+        {name, typeStr, getter, setter, s, notify, reset, bindable};
     }
     template <typename S> constexpr auto setNotify(const S&s) const {
-        return MetaPropertyInfo<Type, Getter, Setter, Member, S, Reset,
+        return MetaPropertyInfo<Type, Getter, Setter, Member, S, Reset, Bindable,
                                 Flags | PropertyFlags::Notify>
-        { name, typeStr, getter, setter, member, s, reset};
+        { name, typeStr, getter, setter, member, s, reset, bindable};
     }
     template <typename S> constexpr auto setReset(const S&s) const {
-        return MetaPropertyInfo<Type, Getter, Setter, Member, Notify, S,
+        return MetaPropertyInfo<Type, Getter, Setter, Member, Notify, S, Bindable,
                                 Flags | PropertyFlags::Resettable>
-        { name, typeStr, getter, setter, member, notify, s};
+        { name, typeStr, getter, setter, member, notify, s, bindable};
+    }
+    template <typename S> constexpr auto setBindable(const S&s) const {
+        return MetaPropertyInfo<Type, Getter, Setter, Member, Notify, Reset, S,
+                                Flags | PropertyFlags::Bindable>
+        { name, typeStr, getter, setter, member, notify, reset, s};
     }
     template <int Flag> constexpr auto addFlag() const {
-        return MetaPropertyInfo<Type, Getter, Setter, Member, Notify, Reset,
+        return MetaPropertyInfo<Type, Getter, Setter, Member, Notify, Reset, Bindable,
                                 Flags | Flag>
-        { name, typeStr, getter, setter, member, notify, reset};
+        { name, typeStr, getter, setter, member, notify, reset, bindable};
     }
 };
 
@@ -443,6 +487,17 @@ template <typename PropInfo, typename Obj, typename Ret, typename... Tail>
 constexpr auto parseProperty(const PropInfo &p, decltype(W_Reset), Ret (Obj::*s)() noexcept, Tail... t)
 { return parseProperty(p.setReset(s) ,t...); }
 #endif
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+// bindable: a member function returning a QBindable
+template <typename PropInfo, typename Obj, typename Ret, typename... Tail>
+constexpr auto parseProperty(const PropInfo &p, decltype(W_Bindable), Ret (Obj::*s)(), Tail... t)
+{ return parseProperty(p.setBindable(s) ,t...); }
+#if defined(__cpp_noexcept_function_type) && __cpp_noexcept_function_type >= 201510
+template <typename PropInfo, typename Obj, typename Ret, typename... Tail>
+constexpr auto parseProperty(const PropInfo &p, decltype(W_Bindable), Ret (Obj::*s)() noexcept, Tail... t)
+{ return parseProperty(p.setBindable(s) ,t...); }
+#endif
+#endif
 // other flags flags
 template <typename PropInfo, int Flag, typename... Tail>
 constexpr auto parseProperty(const PropInfo &p, std::integral_constant<int, Flag>, Tail... t)
@@ -450,7 +505,7 @@ constexpr auto parseProperty(const PropInfo &p, std::integral_constant<int, Flag
 
 template<typename T, typename ... Args>
 constexpr auto makeMetaPropertyInfo(StringView name, StringView type, Args... args) {
-    auto meta = MetaPropertyInfo<T>{ name, type, {}, {}, {}, {}, {} };
+    auto meta = MetaPropertyInfo<T>{ name, type, {}, {}, {}, {}, {}, {} };
     return parseProperty(meta, args...);
 }
 
@@ -498,6 +553,105 @@ template<int N> constexpr int removedScopeSize(const char (&name)[N]) {
     return N - p;
 }
 
+/// Set of the signals of the class Obj that were connected, used by W_SKIP_UNCONNECTED_SIGNALS.
+/// The index of a signal is taken modulo 64: a bit may be shared by several signals, which only
+/// means that an unconnected signal goes through QMetaObject::activate as usual.
+/// Bits are never cleared when a signal is disconnected, for the same reason.
+template<typename Obj> struct ConnectedSignals {
+    std::atomic<quint64> bits{0};
+
+    template<typename Method> // template so QMetaMethod does not need to be complete
+    void connectNotify(const Method &signal) {
+        const QMetaObject *mo = &Obj::staticMetaObject;
+        if (signal.enclosingMetaObject() == mo)
+            bits.fetch_or(quint64(1) << ((signal.methodIndex() - mo->methodOffset()) % 64), std::memory_order_relaxed);
+    }
+    bool test(int signalIdx) const {
+        return bits.load(std::memory_order_relaxed) & (quint64(1) << (signalIdx % 64));
+    }
+};
+
+/// Whether the signal Idx of an object of class Obj may be connected.
+/// Always true, unless Obj itself (and not only one of its base class) uses W_SKIP_UNCONNECTED_SIGNALS
+struct SignalConnectionCheck {
+    template<typename Obj>
+    static auto mayBeConnected(const Obj *o, int idx, int)
+        -> std::enable_if_t<std::is_same<decltype(o->w_connectedSignals), ConnectedSignals<Obj>>::value, bool>
+    { return o->w_connectedSignals.test(idx); }
+    template<typename Obj>
+    static constexpr bool mayBeConnected(const Obj *, int, ...) { return true; }
+};
+
+/// Calls QMetaObject::activate for the signal 'idx' of the object 'o', with the address of the
+/// return value and of the arguments.
+/// It does not depend on the class nor on the index of the signal, so there is only one
+/// instantiation per signature. The overload taking std::true_type is never inlined, for W_OUTLINE_SIGNALS.
+template<typename Ret, typename... Args> struct SignalActivator {
+    static Ret activate(std::false_type, QObject *o, const QMetaObject *mo, int idx, const Args &... args) {
+        Ret r{};
+        const void * a[]= { std::addressof(r), std::addressof(args)... };
+        QMetaObject::activate(o, mo, idx, const_cast<void **>(a));
+        return r;
+    }
+    Q_NEVER_INLINE static Ret activate(std::true_type, QObject *o, const QMetaObject *mo, int idx, const Args &... args)
+    { return activate(std::false_type{}, o, mo, idx, args...); }
+};
+template<typename... Args> struct SignalActivator<void, Args...> {
+    static void activate(std::false_type, QObject *o, const QMetaObject *mo, int idx, const Args &... args) {
+        const void * a[]= { nullptr, std::addressof(args)... };
+        QMetaObject::activate(o, mo, idx, const_cast<void **>(a));
+    }
+    Q_NEVER_INLINE static void activate(std::true_type, QObject *o, const QMetaObject *mo, int idx, const Args &... args)
+    { activate(std::false_type{}, o, mo, idx, args...); }
+};
+
+/// Emits the signal Idx of an object of class Obj.
+/// The call to QMetaObject::activate is inlined, unless Obj itself uses W_OUTLINE_SIGNALS
+struct SignalEmission {
+    template<typename Obj>
+    static auto isOutlined(int) -> std::is_same<typename Obj::w_OutlinedSignalsType, Obj>;
+    template<typename Obj>
+    static std::false_type isOutlined(...);
+
+    template<typename Obj, typename Ret, typename... Args>
+    static Ret activate(const Obj *o, int idx, const std::remove_reference_t<Args> &... args) {
+        using Activator = SignalActivator<Ret, std::remove_cv_t<std::remove_reference_t<Args>>...>;
+        return Activator::activate(decltype(isOutlined<Obj>(0)){}, const_cast<Obj *>(o),
+                                   &Obj::staticMetaObject, idx, args...);
+    }
+
+    /// Calls the slots connected with W_STATIC_CONNECT to the signal of index Idx of Obj
+    template<typename Obj, int Idx, typename... Args>
+    static void callStaticConnections(const Obj *o, const Args &... args);
+
+    /// Forgets the cached value of the W_CACHED properties of Obj whose NOTIFY signal is the
+    /// signal Idx, if Obj itself uses W_CACHED_PROPERTIES
+    template<typename Obj, int Idx>
+    static auto invalidateCachedProperties(const Obj *o, int)
+        -> std::enable_if_t<std::is_same<typename decltype(o->w_propertyCache)::Object, Obj>::value>
+    { o->w_propertyCache.template invalidate<Idx>(); }
+    template<typename Obj, int Idx>
+    static void invalidateCachedProperties(const Obj *, ...) {}
+
+    /// Marks as changed the properties of Obj whose NOTIFY signal is the signal Idx, if Obj itself
+    /// uses W_TRACK_PROPERTY_CHANGES
+    template<typename Obj, int Idx>
+    static auto markChangedProperties(const Obj *o, int)
+        -> std::enable_if_t<std::is_same<typename decltype(o->w_changedProperties)::Object, Obj>::value>
+    { o->w_changedProperties.template mark<Idx>(); }
+    template<typename Obj, int Idx>
+    static void markChangedProperties(const Obj *, ...) {}
+
+    /// Returns true if the signal Idx of Obj is the NOTIFY signal of properties of Obj while a
+    /// w_cpp::PropertyTransaction is open on o: the signal is then emitted when it ends, instead.
+    template<typename Obj, int Idx>
+    static auto deferNotifySignal(const Obj *o, int)
+        -> std::enable_if_t<std::is_same<typename decltype(o->w_changedProperties)::Object, Obj>::value, bool>
+    { return o->w_changedProperties.template defer<Idx>(); }
+    template<typename Obj, int Idx>
+    static bool deferNotifySignal(const Obj *, ...) { return false; }
+};
+
 /// Helper for the implementation of a signal.
 /// Called from the signal implementation within the W_SIGNAL macro.
 ///
@@ -509,41 +663,66 @@ template<int N> constexpr int removedScopeSize(const char (&name)[N]) {
 ///
 /// the last argument of the operator() is an int, to workaround the ",0" required in the W_SIGNAL
 /// macro to make sure there is at least one argument for the ...
+///
+/// The arguments are taken by reference, so the parameters of the signal are passed to
+/// QMetaObject::activate without being copied again.
+///
+/// Nothing is done if the class uses W_SKIP_UNCONNECTED_SIGNALS and the signal was never connected.
 template<typename Func, int Idx> struct SignalImplementation {};
 template<typename Obj, typename Ret, typename... Args, int Idx>
 struct SignalImplementation<Ret (Obj::*)(Args...), Idx>{
     Obj *this_;
-    Ret operator()(Args... args, int) const {
-        Ret r{};
-        const void * a[]= { std::addressof(r), std::addressof(args)... };
-        QMetaObject::activate(this_, &Obj::staticMetaObject, Idx, const_cast<void **>(a));
-        return r;
+    Ret operator()(const std::remove_reference_t<Args> &... args, int) const {
+        SignalEmission::invalidateCachedProperties<Obj, Idx>(this_, 0);
+        SignalEmission::markChangedProperties<Obj, Idx>(this_, 0);
+        if (SignalEmission::deferNotifySignal<Obj, Idx>(this_, 0))
+            return Ret{};
+        SignalEmission::callStaticConnections<Obj, Idx>(this_, args...);
+        if (!SignalConnectionCheck::mayBeConnected(this_, Idx, 0))
+            return Ret{};
+        return SignalEmission::activate<Obj, Ret, Args...>(this_, Idx, args...);
     }
 };
 template<typename Obj, typename... Args, int Idx>
 struct SignalImplementation<void (Obj::*)(Args...), Idx>{
     Obj *this_;
-    void operator()(Args... args, int) {
-        const void * a[]= { nullptr, std::addressof(args)... };
-        QMetaObject::activate(this_, &Obj::staticMetaObject, Idx, const_cast<void **>(a));
+    void operator()(const std::remove_reference_t<Args> &... args, int) {
+        SignalEmission::invalidateCachedProperties<Obj, Idx>(this_, 0);
+        SignalEmission::markChangedProperties<Obj, Idx>(this_, 0);
+        if (SignalEmission::deferNotifySignal<Obj, Idx>(this_, 0))
+            return;
+        SignalEmission::callStaticConnections<Obj, Idx>(this_, args...);
+        if (!SignalConnectionCheck::mayBeConnected(this_, Idx, 0))
+            return;
+        SignalEmission::activate<Obj, void, Args...>(this_, Idx, args...);
     }
 };
 template<typename Obj, typename Ret, typename... Args, int Idx>
 struct SignalImplementation<Ret (Obj::*)(Args...) const, Idx>{
     const Obj *this_;
-    Ret operator()(Args... args, int) const {
-        Ret r{};
-        const void * a[]= { std::addressof(r), std::addressof(args)... };
-        QMetaObject::activate(const_cast<Obj*>(this_), &Obj::staticMetaObject, Idx, const_cast<void **>(a));
-        return r;
+    Ret operator()(const std::remove_reference_t<Args> &... args, int) const {
+        SignalEmission::invalidateCachedProperties<Obj, Idx>(this_, 0);
+        SignalEmission::markChangedProperties<Obj, Idx>(this_, 0);
+        if (SignalEmission::deferNotifySignal<Obj, Idx>(this_, 0))
+            return Ret{};
+        SignalEmission::callStaticConnections<Obj, Idx>(this_, args...);
+        if (!SignalConnectionCheck::mayBeConnected(this_, Idx, 0))
+            return Ret{};
+        return SignalEmission::activate<Obj, Ret, Args...>(this_, Idx, args...);
     }
 };
 template<typename Obj, typename... Args, int Idx>
 struct SignalImplementation<void (Obj::*)(Args...) const, Idx>{
     const Obj *this_;
-    void operator()(Args... args, int) {
-        const void * a[]= { nullptr, std::addressof(args)... };
-        QMetaObject::activate(const_cast<Obj*>(this_), &Obj::staticMetaObject, Idx, const_cast<void **>(a));
+    void operator()(const std::remove_reference_t<Args> &... args, int) {
+        SignalEmission::invalidateCachedProperties<Obj, Idx>(this_, 0);
+        SignalEmission::markChangedProperties<Obj, Idx>(this_, 0);
+        if (SignalEmission::deferNotifySignal<Obj, Idx>(this_, 0))
+            return;
+        SignalEmission::callStaticConnections<Obj, Idx>(this_, args...);
+        if (!SignalConnectionCheck::mayBeConnected(this_, Idx, 0))
+            return;
+        SignalEmission::activate<Obj, void, Args...>(this_, Idx, args...);
     }
 };
 
@@ -774,6 +953,233 @@ struct PropertyStateTag {};
 struct EnumStateTag {};
 struct ClassInfoStateTag {};
 struct InterfaceStateTag {};
+struct StaticConnectStateTag {};
+
+constexpr bool sameName(StringView a, StringView b) {
+    if (a.size() != b.size())
+        return false;
+    for (qptrdiff i = 0; i < a.size(); ++i) {
+        if (a.b[i] != b.b[i])
+            return false;
+    }
+    return true;
+}
+
+/// Whether the W_STATIC_CONNECT of index J of Obj is connected to its signal of index Idx
+template<typename Obj, int Idx, size_t J>
+constexpr bool isStaticConnectionOf() {
+    using TPP = Obj**;
+    using Connection = decltype(w_state(index<J>, StaticConnectStateTag{}, TPP{}));
+    using Signal = decltype(w_state(index<Idx>, SignalStateTag{}, TPP{}));
+    return std::is_same<typename Connection::Signal, typename Signal::Func>::value
+        && sameName(w_state(index<J>, StaticConnectStateTag{}, TPP{}).signalName,
+                    w_state(index<Idx>, SignalStateTag{}, TPP{}).name);
+}
+
+template<typename Obj, size_t J>
+void callStaticConnection(std::false_type, Obj *, void **) {}
+template<typename Obj, size_t J>
+void callStaticConnection(std::true_type, Obj *o, void **argv) {
+    constexpr auto connection = w_state(index<J>, StaticConnectStateTag{}, static_cast<Obj**>(nullptr));
+    using SignalType = QtPrivate::FunctionPointer<typename decltype(connection)::Signal>;
+    using SlotType = QtPrivate::FunctionPointer<decltype(connection.slot)>;
+    SlotType::template call<typename SignalType::Arguments, typename SlotType::ReturnType>(connection.slot, o, argv);
+}
+
+template<typename Obj, int Idx, size_t... J, typename... Args>
+void callStaticConnections(std::index_sequence<J...>, Obj *o, const Args &... args) {
+    if (o->signalsBlocked())
+        return;
+    void *argv[] = { nullptr, const_cast<void *>(static_cast<const void *>(std::addressof(args)))... };
+    Q_UNUSED(argv)
+    ordered2<int>({(callStaticConnection<Obj, J>(std::integral_constant<bool, isStaticConnectionOf<Obj, Idx, J>()>{}, o, argv), 0)...});
+}
+template<typename Obj, int Idx, typename... Args>
+void callStaticConnections(std::index_sequence<>, Obj *, const Args &...) {}
+
+template<typename Obj, int Idx, typename... Args>
+void SignalEmission::callStaticConnections(const Obj *o, const Args &... args) {
+    constexpr size_t count = stateCount<1024*1024*1024, StaticConnectStateTag, Obj**>;
+    w_internal::callStaticConnections<Obj, Idx>(make_index_sequence<count>{}, const_cast<Obj *>(o), args...);
+}
+
+/// Whether the signal SigIdx of Obj is the NOTIFY signal of its property PropIdx
+template<typename Obj, size_t PropIdx, size_t SigIdx,
+         bool Eq = w_state(index<SigIdx>, SignalStateTag{}, static_cast<Obj**>(nullptr)).func
+                == w_state(index<PropIdx>, PropertyStateTag{}, static_cast<Obj**>(nullptr)).notify>
+constexpr bool isNotifySignalOf(int) { return Eq; }
+template<typename Obj, size_t PropIdx, size_t SigIdx>
+constexpr bool isNotifySignalOf(float) { return false; }
+
+template<typename Obj, size_t I>
+using PropertyInfoType = std::decay_t<decltype(w_state(index<I>, PropertyStateTag{}, static_cast<Obj**>(nullptr)))>;
+
+template<typename Obj, typename Notify> struct IsSignalOf : std::false_type {};
+template<typename Obj, typename... Args> struct IsSignalOf<Obj, void (Obj::*)(Args...)> : std::true_type {};
+template<typename Obj, typename... Args> struct IsSignalOf<Obj, void (Obj::*)(Args...) const> : std::true_type {};
+
+/// The last value returned by the getter of the property I of Obj, if it is W_CACHED
+template<typename Obj, size_t I, bool = (PropertyInfoType<Obj, I>::flags & uint(PropertyFlags::Cached)) != 0>
+struct CachedPropertyValue {
+    void invalidate() {}
+};
+template<typename Obj, size_t I>
+struct CachedPropertyValue<Obj, I, true> {
+    using Prop = PropertyInfoType<Obj, I>;
+    static_assert(!std::is_same<decltype(Prop::getter), Empty>::value, "W_CACHED properties need a READ getter");
+    static_assert(IsSignalOf<Obj, decltype(Prop::notify)>::value || (Prop::flags & uint(PropertyFlags::Constant)),
+                  "W_CACHED properties need a NOTIFY signal declared in the same class, or to be CONSTANT");
+    typename Prop::PropertyType value{};
+    bool valid = false;
+    void invalidate() { valid = false; }
+};
+
+template<typename Obj, typename Seq> struct PropertyCacheValues;
+template<typename Obj, size_t... I>
+struct PropertyCacheValues<Obj, index_sequence<I...>> {
+    std::tuple<CachedPropertyValue<Obj, I>...> values;
+
+    template<int SigIdx>
+    void invalidate() {
+        ordered2<int>({(isNotifySignalOf<Obj, I, SigIdx>(0) ? std::get<I>(values).invalidate() : void(), 0)...});
+    }
+};
+
+/// Per object storage of W_CACHED_PROPERTIES, for the first Count properties of Obj
+template<typename Obj, size_t Count>
+struct PropertyCache : PropertyCacheValues<Obj, make_index_sequence<Count>> {
+    using Object = Obj;
+    static constexpr size_t count = Count;
+    template<size_t I>
+    CachedPropertyValue<Obj, I> &value() { return std::get<I>(this->values); }
+};
+
+/// A set of property indices, relative to the first property of a class with N properties.
+/// Iterating over it gives the indices in the set, in increasing order.
+template<size_t N>
+class PropertyBits {
+    static constexpr size_t wordCount = N ? (N + 63) / 64 : 1;
+    quint64 words[wordCount] = {};
+public:
+    static constexpr size_t size() { return N; }
+    void set(size_t i) { words[i / 64] |= quint64(1) << (i % 64); }
+    bool test(size_t i) const { return words[i / 64] & (quint64(1) << (i % 64)); }
+    void reset() { for (auto &w : words) w = 0; }
+    bool any() const {
+        for (auto w : words)
+            if (w)
+                return true;
+        return false;
+    }
+    int count() const {
+        int c = 0;
+        for (auto w : words)
+            c += int(qPopulationCount(w));
+        return c;
+    }
+    PropertyBits &operator|=(const PropertyBits &other) {
+        for (size_t i = 0; i < wordCount; ++i)
+            words[i] |= other.words[i];
+        return *this;
+    }
+
+    class const_iterator {
+        const quint64 *words;
+        size_t word;
+        quint64 rest;
+        friend class PropertyBits;
+        const_iterator(const quint64 *words, size_t word, quint64 rest) : words(words), word(word), rest(rest) {}
+        void skipEmptyWords() {
+            while (!rest && ++word < wordCount)
+                rest = words[word];
+        }
+    public:
+        int operator*() const { return int(word * 64 + qCountTrailingZeroBits(rest)); }
+        const_iterator &operator++() { rest &= rest - 1; skipEmptyWords(); return *this; }
+        bool operator==(const const_iterator &other) const { return word == other.word && rest == other.rest; }
+        bool operator!=(const const_iterator &other) const { return !(*this == other); }
+    };
+    const_iterator begin() const {
+        const_iterator it(words, 0, words[0]);
+        it.skipEmptyWords();
+        return it;
+    }
+    const_iterator end() const { return const_iterator(words, wordCount, 0); }
+};
+
+template<typename Obj, typename Seq> struct ChangedPropertiesMarker;
+template<typename Obj, size_t... I>
+struct ChangedPropertiesMarker<Obj, index_sequence<I...>> {
+    template<int SigIdx>
+    static void mark(PropertyBits<sizeof...(I)> &bits) {
+        ordered2<int>({(isNotifySignalOf<Obj, I, SigIdx>(0) ? bits.set(I) : void(), 0)...});
+    }
+};
+
+/// Whether a signal of type F can be emitted again later with the value of a property of type T:
+/// it has no argument, or one that can be initialized with the value
+template<typename F, typename T> struct CanEmitWithPropertyValue : std::false_type {};
+template<typename R, typename C, typename T> struct CanEmitWithPropertyValue<R (C::*)(), T> : std::true_type {};
+template<typename R, typename C, typename T> struct CanEmitWithPropertyValue<R (C::*)() const, T> : std::true_type {};
+template<typename R, typename C, typename A, typename T>
+struct CanEmitWithPropertyValue<R (C::*)(A), T> : std::is_convertible<const T &, A> {};
+template<typename R, typename C, typename A, typename T>
+struct CanEmitWithPropertyValue<R (C::*)(A) const, T> : std::is_convertible<const T &, A> {};
+template<typename R, typename C, typename A>
+struct CanEmitWithPropertyValue<R (C::*)(A), void> : std::false_type {};
+template<typename R, typename C, typename A>
+struct CanEmitWithPropertyValue<R (C::*)(A) const, void> : std::false_type {};
+
+template<typename Obj, int I, bool = (I >= 0)> struct NotifiedPropertyType { using Type = void; };
+template<typename Obj, int I> struct NotifiedPropertyType<Obj, I, true> {
+    using Type = typename PropertyInfoType<Obj, size_t(I)>::PropertyType;
+};
+
+/// The first property of Obj having the signal SigIdx as NOTIFY signal, or -1
+template<typename Obj, int SigIdx, size_t... I>
+constexpr int firstNotifiedProperty(index_sequence<I...>) {
+    int r = -1;
+    ordered2<int>({(r < 0 && isNotifySignalOf<Obj, I, SigIdx>(0) ? r = int(I) : 0)...});
+    return r;
+}
+
+template<typename Obj, typename Seq, int SigIdx>
+struct NotifySignalInfo {
+    static constexpr int firstProperty = firstNotifiedProperty<Obj, SigIdx>(Seq{});
+    using Func = decltype(w_state(index<SigIdx>, SignalStateTag{}, static_cast<Obj**>(nullptr)).func);
+    /// A PropertyTransaction defers the signal if it can emit it again at the end
+    static constexpr bool deferrable = firstProperty >= 0
+        && CanEmitWithPropertyValue<Func, typename NotifiedPropertyType<Obj, firstProperty>::Type>::value;
+};
+
+/// Per object storage of W_TRACK_PROPERTY_CHANGES, for the first Count properties of Obj
+template<typename Obj, size_t Count>
+struct ChangedProperties {
+    using Object = Obj;
+    using Marker = ChangedPropertiesMarker<Obj, make_index_sequence<Count>>;
+    template<int SigIdx>
+    using SignalInfo = NotifySignalInfo<Obj, make_index_sequence<Count>, SigIdx>;
+
+    PropertyBits<Count> bits;
+    /// The properties whose NOTIFY signal was deferred by the open PropertyTransaction
+    PropertyBits<Count> deferred;
+    int transactionDepth = 0;
+
+    template<int SigIdx>
+    void mark() { Marker::template mark<SigIdx>(bits); }
+
+    template<int SigIdx>
+    bool defer() { return defer<SigIdx>(std::integral_constant<bool, SignalInfo<SigIdx>::deferrable>{}); }
+    template<int SigIdx>
+    bool defer(std::false_type) { return false; }
+    template<int SigIdx>
+    bool defer(std::true_type) {
+        if (!transactionDepth)
+            return false;
+        Marker::template mark<SigIdx>(deferred);
+        return true;
+    }
+};
 
 } // namespace w_internal
 
@@ -868,6 +1274,18 @@ struct InterfaceStateTag {};
 /// Like W_SLOT, there can be the types of the parametter as a second argument, within parentheses.
 /// You must then follow with the parameter names
 ///
+/// Note about the cost of the arguments: the arguments are passed by address to the receivers, so a
+/// signal taking its parameter by value only copies it when it is called with an lvalue (pass a
+/// temporary or use std::move). A queued connection copies each argument once more into the event,
+/// with the copy constructor registered in QMetaType: this copy is done by Qt and cannot be turned
+/// into a move. Use implicitly shared types (QByteArray, QVector, QSharedDataPointer, ...) for big
+/// payloads sent across threads.
+///
+/// Note about signals returning a value: the return value is value-initialized before the
+/// receivers are called, and the receivers assign their result to it. A signal returning a type that
+/// is expensive or impossible to default construct can be declared to return std::optional<T>: it is
+/// then only constructed if a receiver returns a value, and is std::nullopt otherwise.
+///
 /// Note about exported classes: since the signal is inline, GCC won't export it when compiling
 /// with -fvisibility-inlines-hidden (which is the default), so connecting using pointer to member
 /// functions won't work accross library boundaries. You need to explicitly export the signal with
@@ -904,6 +1322,23 @@ struct InterfaceStateTag {};
                 W_PARAM_TOSTRING(W_OVERLOAD_TYPES(__VA_ARGS__)), W_PARAM_TOSTRING(W_OVERLOAD_REMOVE(__VA_ARGS__)), W_Compat)) \
     static inline void w_GetAccessSpecifierHelper(W_INTEGRAL_CONSTANT_HELPER(NAME, __VA_ARGS__)) {}
 
+/// \macro W_STATIC_CONNECT(<signal>, <slot>)
+/// Connects the signal <signal> of this class to the member function <slot> for all the objects of
+/// this class, instead of calling QObject::connect in the constructor. The slot is called directly
+/// from the implementation of the signal, before the slots connected at run time: there is no
+/// connection object and no call to QMetaObject::activate for it. The slot does not need to be
+/// declared with W_SLOT, and can take fewer arguments than the signal. To reach a child object,
+/// use a member function that forwards to it.
+/// Must be put after the declaration of the signal and of the slot, which cannot be overloaded.
+/// Such a connection cannot be disconnected and is not counted by QObject::receivers.
+/// The signal must be declared in this class: the signals inherited from a base class are emitted by
+/// the code of the base class, which does not know about the connection.
+/// Like with Qt::DirectConnection, the slot is called synchronously in the thread that emits the
+/// signal, whatever the thread of the object.
+#define W_STATIC_CONNECT(SIGNAL, SLOT) \
+    W_STATE_APPEND(StaticConnectState, w_internal::makeMetaStaticConnectionInfo<W_ThisType>( \
+            &W_ThisType::SIGNAL, w_internal::viewLiteral(#SIGNAL), &W_ThisType::SLOT))
+
 /// \macro W_CONSTRUCTOR(<parameter types>)
 /// Declares that this class can be constructed with this list of argument.
 /// Equivalent to Q_INVOKABLE constructor.
@@ -937,15 +1372,25 @@ struct InterfaceStateTag {};
 #define W_READ , &W_ThisType::
 #define W_NOTIFY , W_Notify, &W_ThisType::
 #define W_RESET , W_Reset, &W_ThisType::
+#define W_BINDABLE , W_Bindable, &W_ThisType::
 #define W_MEMBER , &W_ThisType::
 #define W_CONSTANT , W_Constant
 #define W_FINAL , W_Final
+/// By default, writing a MEMBER property with a value equal to the member (compared with !=, if
+/// the type and, for a container, its elements can be compared) neither assigns it nor emits the
+/// NOTIFY signal, like moc does.
+/// W_NO_COMPARE always assigns and notifies, for types whose comparison is expensive.
+#define W_NO_COMPARE , W_NoCompare
+/// W_CACHED keeps the result of the READ getter until the NOTIFY signal is emitted. The class must
+/// use W_CACHED_PROPERTIES.
+#define W_CACHED , W_Cached
 
 #ifndef W_NO_PROPERTY_MACRO
 #define WRITE     W_WRITE
 #define READ      W_READ
 #define NOTIFY    W_NOTIFY
 #define RESET     W_RESET
+#define BINDABLE  W_BINDABLE
 #define MEMBER    W_MEMBER
 #define CONSTANT  W_CONSTANT
 #define FINAL     W_FINAL
@@ -1003,6 +1448,82 @@ struct InterfaceStateTag {};
 #define W_INTERFACE(A) \
     W_STATE_APPEND(InterfaceState, static_cast<A*>(nullptr))
 
+/// \macro W_SKIP_UNCONNECTED_SIGNALS
+/// Opt-in, to be put in a W_OBJECT class after W_OBJECT. The class then remembers which of its
+/// signals were connected, and emitting a signal that was never connected returns right away,
+/// without building the arguments array and without calling QMetaObject::activate.
+///
+/// This reimplements connectNotify, which the class must therefore not reimplement itself.
+/// QObject::connect and QMetaObject::connect call connectNotify, so all their connections are seen.
+/// What does not go through connectNotify is not seen: the signal spy callbacks (used by debugging
+/// tools), and the QML endpoints connected without notification (QQmlData::connectEndpoint with
+/// doNotify false). Do not use it for classes used from QML or inspected with such tools.
+/// It only applies to the signals declared in the class itself, not to the ones of its base or
+/// derived classes. The access specifier after the macro is private.
+#define W_SKIP_UNCONNECTED_SIGNALS \
+    protected: \
+        void connectNotify(const QMetaMethod &signal) override { \
+            w_connectedSignals.connectNotify(signal); \
+            W_BaseType::connectNotify(signal); \
+        } \
+    private: \
+        friend struct w_internal::SignalConnectionCheck; \
+        w_internal::ConnectedSignals<W_ThisType> w_connectedSignals;
+
+/// \macro W_OUTLINE_SIGNALS
+/// Opt-in, to be put in a W_OBJECT class after W_OBJECT. The signals of the class then call
+/// QMetaObject::activate through a function that is never inlined and that only depends on the
+/// types of the signal arguments. All the signals with the same signature share that code, instead
+/// of each of them inlining it where it is emitted. This reduces the code size for headers declaring
+/// many signals, at the cost of one function call per emission.
+/// It only applies to the signals declared in the class itself, not to the ones of its base or
+/// derived classes. The access specifier after the macro is private.
+#define W_OUTLINE_SIGNALS \
+    private: \
+        friend struct w_internal::SignalEmission; \
+        using w_OutlinedSignalsType = W_ThisType;
+
+/// \macro W_NAME_INDEX
+/// Opt-in, to be put in a W_OBJECT or W_GADGET class after W_OBJECT or W_GADGET. With Qt 6, the
+/// class then has perfect hash tables of the names of its properties and of its methods, built at
+/// compile time, which w_cpp::indexOfProperty and w_cpp::indexOfMethod use instead of comparing the
+/// name with each property or method. Building them adds to the compilation time of W_OBJECT_IMPL,
+/// so use it for classes with many properties or methods that are looked up by name at runtime.
+/// It only applies to the properties and methods declared in the class itself, not to the ones of
+/// its base or derived classes. The access specifier after the macro is private.
+#define W_NAME_INDEX \
+    private: \
+        using w_NameIndexType = W_ThisType;
+
+/// \macro W_CACHED_PROPERTIES
+/// Opt-in, to be put in a W_OBJECT class after all its W_PROPERTY. The properties declared with the
+/// W_CACHED flag then keep the value returned by their READ getter in the object, so reading them
+/// again (with the ReadProperty metacall, or w_cpp::getProperty) costs a copy instead of calling
+/// the getter, until their NOTIFY signal is emitted. Use it for getters doing expensive computations.
+/// The NOTIFY signal must be declared in the class itself, and be emitted in the thread reading the
+/// property whenever the result of the getter may change. CONSTANT properties are never recomputed.
+/// The access specifier after the macro is private.
+#define W_CACHED_PROPERTIES \
+    private: \
+        friend struct w_internal::SignalEmission; \
+        mutable w_internal::PropertyCache<W_ThisType, \
+            w_internal::stateCount<__COUNTER__, w_internal::PropertyStateTag, W_ThisType**>> w_propertyCache;
+
+/// \macro W_TRACK_PROPERTY_CHANGES
+/// Opt-in, to be put in a W_OBJECT class after all its W_PROPERTY. Each object then records which of
+/// the properties declared in its class changed: emitting a signal marks the properties having it as
+/// NOTIFY signal, without needing any connection. w_cpp::changedProperties gives these properties
+/// and w_cpp::takeChangedProperties also clears them, so synchronizing the state of the object with
+/// another copy only needs to read the properties that changed since the last time.
+/// It also allows w_cpp::PropertyTransaction on the objects of the class.
+/// The set is not synchronized: take it in the thread of the object, or while that thread is blocked.
+/// The access specifier after the macro is private.
+#define W_TRACK_PROPERTY_CHANGES \
+    private: \
+        friend struct w_internal::SignalEmission; \
+        mutable w_internal::ChangedProperties<W_ThisType, \
+            w_internal::stateCount<__COUNTER__, w_internal::PropertyStateTag, W_ThisType**>> w_changedProperties;
+
 /// Same as Q_DECLARE_FLAGS
 #define W_DECLARE_FLAGS(Flags, Enum) \
     Q_DECLARE_FLAGS(Flags, Enum) \
@@ -1033,4 +1554,10 @@ W_REGISTER_ARGTYPE(const char*)
 #define W_FLAG(...)
 #define W_ENUM(...)
 #define W_DECLARE_FLAGS(...)
+#define W_SKIP_UNCONNECTED_SIGNALS
+#define W_OUTLINE_SIGNALS
+#define W_STATIC_CONNECT(...)
+#define W_NAME_INDEX
+#define W_CACHED_PROPERTIES
+#define W_TRACK_PROPERTY_CHANGES
 #endif
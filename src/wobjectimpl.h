@@ -23,6 +23,13 @@
 
 #include "wobjectdefs.h"
 #include <QtCore/qobject.h>
+#include <QtCore/qmetaobject.h>
+#include <QtCore/qthread.h>
+#include <QtCore/qbitarray.h>
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+#include <QtCore/qproperty.h>
+#endif
+#include <memory>
 
 namespace w_internal {
 
@@ -51,6 +58,7 @@ struct ObjectInfo {
     static constexpr int classInfoCount = stateCount<L, ClassInfoStateTag, T**>;
     static constexpr int interfaceCount = stateCount<L, InterfaceStateTag, T**>;
 
+    static constexpr auto signalSequence = make_index_sequence<signalCount>{};
     static constexpr auto methodSequence = make_index_sequence<methodCount>{};
     static constexpr auto constructorSequence = make_index_sequence<constructorCount>{};
     static constexpr auto propertySequence = make_index_sequence<propertyCount>{};
@@ -140,6 +148,212 @@ constexpr bool isPropertyMetacall(QMetaObject::Call call) noexcept
 #endif
 }
 
+/// A class name or an interface IID, with its length and hash, so that qt_metacast can reject
+/// mismatches without a strcmp
+struct MetaCastKey {
+    const char *str;
+    size_t size;
+    uint hash;
+};
+/// FNV-1a
+constexpr uint metaCastHash(const char *b, const char *e) noexcept {
+    uint h = 2166136261u;
+    for (; b != e; ++b)
+        h = (h ^ uchar(*b)) * 16777619u;
+    return h;
+}
+inline MetaCastKey makeMetaCastKey(const char *str) noexcept {
+    const char *e = str;
+    while (*e)
+        ++e;
+    return { str, size_t(e - str), metaCastHash(str, e) };
+}
+
+/// Column of a property metacall in the table of property operations, or -1 if the call
+/// is not handled by the table
+constexpr int propertyMetacallKind(QMetaObject::Call call) noexcept
+{
+    return call == QMetaObject::ReadProperty ? 0
+        : call == QMetaObject::WriteProperty ? 1
+        : call == QMetaObject::ResetProperty ? 2
+        : call == QMetaObject::RegisterPropertyMetaType ? 3
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+        : call == QMetaObject::BindableProperty ? 4
+#endif
+        : -1;
+}
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+constexpr int propertyMetacallKindCount = 5;
+#else
+constexpr int propertyMetacallKindCount = 4;
+#endif
+
+/// Compares a StringView with the string 's' of size 'n', at compile time
+constexpr bool viewEquals(StringView v, const char *s, size_t n) {
+    if (size_t(v.size()) != n)
+        return false;
+    for (size_t i = 0; i < n; ++i) {
+        if (v.b[i] != s[i])
+            return false;
+    }
+    return true;
+}
+
+/// Slot of a name of hash 'h' in a NameIndex, for the seed of its bucket
+constexpr uint nameSlot(uint h, uint seed) noexcept {
+    h ^= seed * 0x9e3779b9u;
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+    return h;
+}
+
+/// Perfect hash table of the names of the properties or of the methods of a class using
+/// W_NAME_INDEX, used by w_cpp::indexOfProperty and w_cpp::indexOfMethod.
+/// The names are distributed in buckets according to their hash, and the seed of each bucket was
+/// chosen at compile time so that all the names get a different slot: a lookup hashes the name
+/// and compares it with at most one name. Entries with the same name (overloads) are chained by 'next'.
+struct NameIndex {
+    static constexpr uint NoSeed = ~0u; // no seed was found for that bucket: its names are scanned
+    const StringView *names;
+    const uint *hashes;
+    const int *next; // next entry with the same name, or -1
+    const uint *seeds;
+    const int *slots; // first entry with the name in the slot, or -1
+    uint bucketCount;
+    uint slotMask;
+    int count;
+
+    bool matches(int i, uint h, const char *name, size_t len) const noexcept {
+        return hashes[i] == h && size_t(names[i].size()) == len && !memcmp(names[i].b, name, len);
+    }
+    /// The first entry called 'name', or -1
+    int find(const char *name, size_t len) const noexcept {
+        const uint h = metaCastHash(name, name + len);
+        const uint seed = seeds[h % bucketCount];
+        if (seed != NoSeed) {
+            const int i = slots[nameSlot(h, seed) & slotMask];
+            return i >= 0 && matches(i, h, name, len) ? i : -1;
+        }
+        for (int i = 0; i < count; ++i) {
+            if (matches(i, h, name, len))
+                return i;
+        }
+        return -1;
+    }
+};
+
+/// Passed as the id of a QMetaObject::CustomCall to the qt_static_metacall of a W_OBJECT or
+/// W_GADGET, which then fills the NameIndex pointed to by _a[0]
+constexpr int PropertyNameIndexCall = 0x57504e49;
+constexpr int MethodNameIndexCall = 0x574d4e49;
+
+constexpr uint nextPowerOfTwo(size_t n) {
+    uint p = 1;
+    while (p < n)
+        p *= 2;
+    return p;
+}
+
+/// Storage of a NameIndex for N names
+template<size_t N>
+struct NameTable {
+    static constexpr uint bucketCount = N / 2 + 1;
+    static constexpr uint slotCount = nextPowerOfTwo(2 * N);
+    StringViewArray<N> names = {};
+    uint hashes[N > 0 ? N : 1] = {};
+    int next[N > 0 ? N : 1] = {};
+    uint seeds[bucketCount] = {};
+    int slots[slotCount] = {};
+
+    /// Put the names 'members' of a bucket in the slots given by 'seed', if they are all free
+    constexpr bool tryPlace(const uint *members, int count, uint seed) {
+        for (int i = 0; i < count; ++i) {
+            int &slot = slots[nameSlot(hashes[members[i]], seed) & (slotCount - 1)];
+            if (slot >= 0) {
+                for (int j = 0; j < i; ++j)
+                    slots[nameSlot(hashes[members[j]], seed) & (slotCount - 1)] = -1;
+                return false;
+            }
+            slot = int(members[i]);
+        }
+        return true;
+    }
+
+    NameIndex nameIndex() const {
+        return { names.data, hashes, next, seeds, slots, bucketCount, slotCount - 1, int(N) };
+    }
+};
+
+template<size_t N>
+constexpr NameTable<N> makeNameTable(const StringViewArray<N> &names) {
+    constexpr uint bucketCount = NameTable<N>::bucketCount;
+    constexpr uint maxSeedTries = 256; // the names of a bucket for which no seed is found are scanned
+    NameTable<N> t{};
+    t.names = names;
+    for (size_t i = 0; i < N; ++i)
+        t.hashes[i] = metaCastHash(names[i].b, names[i].e);
+    // all the entries, sorted by bucket and then by index: the entries of the bucket b are
+    // entries[bucketStart[b]...bucketStart[b+1]-1]
+    uint entries[N > 0 ? N : 1] = {};
+    uint bucketStart[bucketCount + 1] = {};
+    for (size_t i = 0; i < N; ++i)
+        ++bucketStart[t.hashes[i] % bucketCount + 1];
+    for (uint b = 0; b < bucketCount; ++b)
+        bucketStart[b + 1] += bucketStart[b];
+    uint filled[bucketCount] = {};
+    for (size_t i = 0; i < N; ++i) {
+        const uint b = t.hashes[i] % bucketCount;
+        entries[bucketStart[b] + filled[b]++] = uint(i);
+    }
+    // Entries with the same name have the same hash, so they are in the same bucket: only the
+    // entries of a bucket are compared. The first entry of each name are the members of the bucket,
+    // moved to the front of its entries.
+    uint memberCount[bucketCount] = {};
+    int maxSize = 0;
+    for (uint b = 0; b < bucketCount; ++b) {
+        for (uint k = bucketStart[b]; k < bucketStart[b + 1]; ++k) {
+            const uint i = entries[k];
+            t.next[i] = -1;
+            bool isFirst = true;
+            for (uint l = bucketStart[b]; l < k && isFirst; ++l) {
+                const uint j = entries[l];
+                isFirst = t.hashes[j] != t.hashes[i] || !viewEquals(names[j], names[i].b, size_t(names[i].size()));
+            }
+            for (uint l = k + 1; l < bucketStart[b + 1]; ++l) {
+                const uint j = entries[l];
+                if (t.hashes[j] == t.hashes[i] && viewEquals(names[j], names[i].b, size_t(names[i].size()))) {
+                    t.next[i] = int(j);
+                    break;
+                }
+            }
+            if (isFirst)
+                entries[bucketStart[b] + memberCount[b]++] = i;
+        }
+        if (int(memberCount[b]) > maxSize)
+            maxSize = int(memberCount[b]);
+    }
+    for (int &slot : t.slots)
+        slot = -1;
+    // The biggest buckets are placed first, while most slots are still free
+    for (int size = maxSize; size > 0; --size) {
+        for (uint b = 0; b < bucketCount; ++b) {
+            if (int(memberCount[b]) != size)
+                continue;
+            t.seeds[b] = NameIndex::NoSeed;
+            for (uint seed = 0; seed < maxSeedTries; ++seed) {
+                if (t.tryPlace(entries + bucketStart[b], size, seed)) {
+                    t.seeds[b] = seed;
+                    break;
+                }
+            }
+        }
+    }
+    return t;
+}
+
 /// Helper to get information about the notify signal of the property within object T
 template<size_t L, size_t PropIdx, typename T, typename O>
 struct ResolveNotifySignal {
@@ -360,7 +574,7 @@ struct PropertyGenerator {
         constexpr uint finalFlag = std::is_final<T>::value ? 0 | PropertyFlags::Final : 0;
         constexpr uint defaultFlags = 0 | PropertyFlags::Stored | PropertyFlags::Scriptable
             | PropertyFlags::Designable;
-        s.addInts(Prop::flags | moreFlags | finalFlag | defaultFlags);
+        s.addInts((Prop::flags & ~verdigrisOnlyPropertyFlags) | moreFlags | finalFlag | defaultFlags);
 #if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
         addSignal(prop.notify, index<Idx>);
         s.addInts(0); // revision
@@ -1007,12 +1221,51 @@ static constexpr const QMetaObject *parentMetaObject(...) { return nullptr; }
 // Bunch of helpers for propertyOperation
 // this uses SFINAE of the return value to work either with F a pointer to member, or to member function
 // or nullptr.
+// The value is forwarded, so a temporary is moved into a setter taking it by value or by rvalue
+// reference, and into the member. The result of a getter returning by value is move-assigned.
 template <typename F, typename O, typename T>
-inline auto propSet(F f, O *o, const T &t) W_RETURN(((o->*f)(t),0))
+inline auto propSet(F f, O *o, T &&t) W_RETURN(((o->*f)(std::forward<T>(t)),0))
 template <typename F, typename O, typename T>
-inline auto propSet(F f, O *o, const T &t) W_RETURN(o->*f = t)
+inline auto propSet(F f, O *o, T &&t) W_RETURN(o->*f = std::forward<T>(t))
 template <typename O, typename T>
-inline void propSet(Empty, O *, const T &) {}
+inline void propSet(Empty, O *, T &&) {}
+
+/// Whether the values of type T can be compared. The operator!= of the containers is declared even
+/// when their elements cannot be compared, so the elements are checked too.
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+template<typename T>
+using IsEqualityComparable = std::integral_constant<bool, QTypeTraits::has_operator_equal_v<T>>;
+#else
+template<typename T, typename = void> struct IsEqualityComparable : std::false_type {};
+template<typename T, typename = void> struct HasComparableElements : std::true_type {};
+template<typename T>
+struct IsEqualityComparable<T, decltype(void(bool(std::declval<const T &>() != std::declval<const T &>())))>
+    : HasComparableElements<T> {};
+template<typename T>
+struct HasComparableElements<T, std::enable_if_t<!std::is_same<typename T::value_type, T>::value>>
+    : IsEqualityComparable<typename T::value_type> {};
+template<typename A, typename B>
+struct HasComparableElements<std::pair<A, B>>
+    : std::integral_constant<bool, IsEqualityComparable<A>::value && IsEqualityComparable<B>::value> {};
+#endif
+
+// Assigns the member and returns true, or returns false if it is already equal to the value.
+// Compare is std::false_type for the W_NO_COMPARE properties, and the types that cannot be compared.
+template <typename F, typename O, typename T>
+inline auto propSetIfChanged(std::true_type, F f, O *o, T &&t)
+    -> std::enable_if_t<IsEqualityComparable<std::decay_t<decltype(o->*f)>>::value, decltype(bool(o->*f != t))> {
+    if (!(o->*f != t))
+        return false;
+    o->*f = std::forward<T>(t);
+    return true;
+}
+template <typename Compare, typename F, typename O, typename T>
+inline bool propSetIfChanged(Compare, F f, O *o, T &&t) {
+    propSet(f, o, std::forward<T>(t));
+    return true;
+}
+template <typename Compare, typename O, typename T>
+inline bool propSetIfChanged(Compare, Empty, O *, T &&) { return false; }
 
 template <typename F, typename O, typename T>
 inline auto propGet(F f, O *o, T &t) W_RETURN(t = (o->*f)())
@@ -1021,6 +1274,15 @@ inline auto propGet(F f, O *o, T &t) W_RETURN(t = o->*f)
 template <typename O, typename T>
 inline void propGet(Empty, O *, T &) {}
 
+// Returns the value of a property as R, constructed directly from the result of the getter,
+// or copied from the member, instead of being assigned into a default constructed R.
+template <typename R, typename F, typename M, typename O>
+inline auto propValue(F f, M, O *o) -> decltype(R((o->*f)())) { return (o->*f)(); }
+template <typename R, typename M, typename O>
+inline auto propValue(Empty, M m, O *o) -> decltype(R(o->*m)) { return o->*m; }
+template <typename R, typename O>
+inline R propValue(Empty, Empty, O *) { return R{}; }
+
 template <typename F, typename M, typename O>
 inline auto propNotify(F f, M m, O *o) W_RETURN(((o->*f)(o->*m),0))
 template <typename F, typename M, typename O>
@@ -1033,6 +1295,67 @@ inline auto propReset(F f, O *o) W_RETURN(((o->*f)(),0))
 template <typename... T>
 inline void propReset(T...) {}
 
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+template <typename F, typename O>
+inline auto propBindable(F f, O *o, QUntypedBindable &b) W_RETURN((b = (o->*f)(),0))
+template <typename... T>
+inline void propBindable(T&&...) {}
+#endif
+
+/// The type of the property I of the class T
+template<typename T, int I>
+using PropertyType = typename std::decay_t<decltype(w_state(index<I>, PropertyStateTag{}, static_cast<T**>(nullptr)))>::PropertyType;
+
+/// Index of the property named 'name' (of size 'n') among the properties of T, or -1
+template<typename T, size_t... PropI>
+constexpr int indexOfPropertyName(const char *name, size_t n, std::index_sequence<PropI...>) {
+    using TPP = T**;
+    // the extra entry avoids a zero-sized array
+    const StringView names[] = { w_state(index<PropI>, PropertyStateTag{}, TPP{}).name..., StringView{} };
+    for (size_t i = 0; i < sizeof...(PropI); ++i) {
+        if (viewEquals(names[i], name, n))
+            return int(i);
+    }
+    return -1;
+}
+
+/// Not constexpr: w_cpp::propertyIndex calls it so it does not compile if the property does not exist
+inline int propertyNameNotFound() { return -1; }
+
+template<typename T, size_t... PropI>
+constexpr StringViewArray<sizeof...(PropI)> propertyNames(std::index_sequence<PropI...>) {
+    using TPP = T**;
+    return {{ w_state(index<PropI>, PropertyStateTag{}, TPP{}).name... }};
+}
+
+/// The NameTable of the properties of the class T
+template<typename T>
+struct PropertyNameTableOf {
+    static constexpr size_t count = stateCount<1024*1024*1024, PropertyStateTag, T**>;
+    static constexpr NameTable<count> value = makeNameTable<count>(propertyNames<T>(make_index_sequence<count>{}));
+};
+#if __cplusplus <= 201700L
+template<typename T>
+constexpr NameTable<PropertyNameTableOf<T>::count> PropertyNameTableOf<T>::value;
+#endif
+
+template<typename T, size_t... MethI>
+constexpr StringViewArray<sizeof...(MethI)> methodNames(std::index_sequence<MethI...>) {
+    using ObjI = typename T::W_MetaObjectCreatorHelper::ObjectInfo;
+    return {{ ObjI::method(index<MethI>).name... }};
+}
+
+/// The NameTable of the methods (signals, slots, and invokable methods) of the class T
+template<typename T>
+struct MethodNameTableOf {
+    static constexpr size_t count = T::W_MetaObjectCreatorHelper::ObjectInfo::methodCount;
+    static constexpr NameTable<count> value = makeNameTable<count>(methodNames<T>(make_index_sequence<count>{}));
+};
+#if __cplusplus <= 201700L
+template<typename T>
+constexpr NameTable<MethodNameTableOf<T>::count> MethodNameTableOf<T>::value;
+#endif
+
 #if QT_VERSION >= QT_VERSION_CHECK(6,3,0) && QT_VERSION < QT_VERSION_CHECK(6, 8, 0)
 // note: Qt 6.3 introduced a check here that allows only QObjects - but we need it for Gadgets as well
 template <typename, typename, typename, typename> struct FunctorCall;
@@ -1124,6 +1447,17 @@ struct FunctorCall<std::index_sequence<II...>, QtPrivate::List<SignalArgs...>, R
 };
 #endif
 
+/// Storage for the pointer to the method I of T, so it can be referenced from a table
+template<typename T, int I>
+struct MethodFunc {
+    using Type = typename decltype(T::W_MetaObjectCreatorHelper::ObjectInfo::method(index<I>))::Func;
+    static constexpr Type value = T::W_MetaObjectCreatorHelper::ObjectInfo::method(index<I>).func;
+};
+#if __cplusplus <= 201700L
+template<typename T, int I>
+constexpr typename MethodFunc<T, I>::Type MethodFunc<T, I>::value;
+#endif
+
 struct FriendHelper {
 
     template<typename T>
@@ -1147,63 +1481,134 @@ struct FriendHelper {
 #endif
     }
 
-    template<typename T> static int qt_metacall_impl(T *_o, QMetaObject::Call _c, int _id, void** _a) {
-        using ObjI = typename T::W_MetaObjectCreatorHelper::ObjectInfo;
-        _id = _o->T::W_BaseType::qt_metacall(_c, _id, _a);
+    /// True if T has its own W_OBJECT (and not a Q_OBJECT, or the W_OBJECT of a base class)
+    template<typename T, typename = void> struct IsWObject : std::false_type {};
+    template<typename T> struct IsWObject<T, std::enable_if_t<std::is_same<typename T::W_ThisType, T>::value>>
+        : std::true_type {};
+
+    /// The number of methods and of properties of the class of a metaobject, read from the header
+    /// of its data (the same layout in moc and in generateDataPass)
+    static int metaObjectMethodCount(const QMetaObject *mo) { return int(mo->d.data[4]); }
+    static int metaObjectPropertyCount(const QMetaObject *mo) { return int(mo->d.data[6]); }
+
+    /// Implementation of qt_metacall for the chain of W_OBJECT classes T, Ds...
+    /// While the base class of T is also a W_OBJECT, it is added to the chain. Otherwise (QObject,
+    /// or a class using moc), the qt_metacall of that base class is called, and the call is
+    /// dispatched to the class owning _id from a table instead of going through the
+    /// qt_metacall of every class in the chain.
+    /// The qt_static_metacall of each class, and its number of methods and properties, are read from
+    /// its staticMetaObject at runtime: Q_OBJECT declares qt_static_metacall with hidden visibility,
+    /// so it cannot be referenced when the class is in another library, and the counts of a class
+    /// in another library may change without the derived classes being recompiled.
+    template<typename T, typename... Ds, typename O>
+    static int flatMetacall(O *_o, QMetaObject::Call _c, int _id, void** _a, std::true_type) {
+        using Base = typename T::W_BaseType;
+        return flatMetacall<Base, T, Ds...>(_o, _c, _id, _a, IsWObject<typename Base::W_BaseType>{});
+    }
+    template<typename T, typename... Ds, typename O>
+    static int flatMetacall(O *_o, QMetaObject::Call _c, int _id, void** _a, std::false_type) {
+        _id = static_cast<T*>(_o)->T::W_BaseType::qt_metacall(_c, _id, _a);
         if (_id < 0)
             return _id;
+        const QMetaObject *const metaObjects[] = { &T::staticMetaObject, &Ds::staticMetaObject... };
+        constexpr size_t levelCount = sizeof...(Ds) + 1;
         if (_c == QMetaObject::InvokeMetaMethod || _c == QMetaObject::RegisterMethodArgumentMetaType) {
-            constexpr int methodCount = ObjI::methodCount;
-            if (_id < methodCount)
-                T::qt_static_metacall(_o, _c, _id, _a);
-            _id -= methodCount;
+            for (size_t i = 0; i < levelCount; ++i) {
+                const int count = metaObjectMethodCount(metaObjects[i]);
+                if (_id < count) {
+                    metaObjects[i]->d.static_metacall(_o, _c, _id, _a);
+                    return _id - count;
+                }
+                _id -= count;
+            }
         } else if (isPropertyMetacall(_c)) {
-            constexpr int propertyCount = ObjI::propertyCount;
-            if (_id < propertyCount)
-                T::qt_static_metacall(_o, _c, _id, _a);
-            _id -= propertyCount;
+            for (size_t i = 0; i < levelCount; ++i) {
+                const int count = metaObjectPropertyCount(metaObjects[i]);
+                if (_id < count) {
+                    metaObjects[i]->d.static_metacall(_o, _c, _id, _a);
+                    return _id - count;
+                }
+                _id -= count;
+            }
         }
         return _id;
     }
 
+    template<typename T> static int qt_metacall_impl(T *_o, QMetaObject::Call _c, int _id, void** _a) {
+        return flatMetacall<T>(_o, _c, _id, _a, IsWObject<typename T::W_BaseType>{});
+    }
+
 QT_WARNING_PUSH
 QT_WARNING_DISABLE_GCC("-Waddress")
     /// Helper for implementation of qt_static_metacall for QMetaObject::IndexOfMethod
-    /// T is the class, and I is the index of a method.
-    /// Returns I if the argument is equal to the pointer to member function of the signal of index 'I'
+    /// T is the class, and I is the index of a signal.
+    /// Returns true if the argument is equal to the pointer to member function of the signal of index 'I'
     template<typename T, int I>
-    static int indexOfMethod(void **func) {
-        using ObjI = typename T::W_MetaObjectCreatorHelper::ObjectInfo;
-        constexpr auto m = ObjI::method(index<I>);
-        if ((m.flags & 0xc) == W_MethodType::Signal.value
-            && m.func == *reinterpret_cast<decltype(m.func)*>(func))
-            return I;
-        return -1;
+    static bool isSignal(void **func) {
+        using TPP = T**;
+        constexpr auto s = w_state(index<I>, SignalStateTag{}, TPP{});
+        return s.func == *reinterpret_cast<decltype(s.func)*>(func);
     }
 QT_WARNING_POP
 
+    /// Implementation of QMetaObject::IndexOfMethod: only the signals are compared (they come
+    /// first in the method list), and the search stops at the first match.
+    template<typename T, size_t... SigI>
+    static int indexOfSignal(void **func, std::index_sequence<SigI...>) {
+        Q_UNUSED(func)
+        int r = -1;
+#if __cplusplus > 201700L
+        (void)((isSignal<T, int(SigI)>(func) ? (r = int(SigI), true) : false) || ...);
+#else
+        bool found = false;
+        ordered2<bool>({(found = found || (isSignal<T, int(SigI)>(func) ? (r = int(SigI), true) : false))...});
+        Q_UNUSED(found)
+#endif
+        return r;
+    }
+
     /// Helper for implementation of qt_static_metacall for QMetaObject::InvokeMetaMethod
-    /// T is the class, and I is the index of a method.
-    /// Invoke the method with index I if id == I.
-    template <typename T, int I>
-    static void invokeMethod(T *_o, int _id, void **_a) {
-        if (_id == I) {
-            using ObjI = typename T::W_MetaObjectCreatorHelper::ObjectInfo;
-            constexpr auto method = ObjI::method(index<I>);
-            using Func = typename decltype(method)::Func;
-            using FP = QtPrivate::FunctionPointer<Func>;
+    /// T is the class, f points to a method of type Func.
+    /// There is one instantiation per signature, shared by all the methods of T with that signature.
+    template <typename T, typename Func, typename ArgSequence>
+    static void invokeMethod(T *_o, const void *f, void **_a) {
+        const Func &func = *static_cast<const Func *>(f);
+        using FP = QtPrivate::FunctionPointer<Func>;
 #if QT_VERSION >= QT_VERSION_CHECK(6,3,0)
-            if constexpr (FP::IsPointerToMemberFunction) {
-                FunctorCall<typename decltype(method)::ArgSequence, typename FP::Arguments, typename FP::ReturnType, Func>::call(method.func, _o, _a);
-            }
-            else {
-                (void)_o;
-                FunctorCall<typename decltype(method)::ArgSequence, typename FP::Arguments, typename FP::ReturnType, Func>::call(method.func, _a);
-            }
+        if constexpr (FP::IsPointerToMemberFunction) {
+            FunctorCall<ArgSequence, typename FP::Arguments, typename FP::ReturnType, Func>::call(func, _o, _a);
+        }
+        else {
+            (void)_o;
+            FunctorCall<ArgSequence, typename FP::Arguments, typename FP::ReturnType, Func>::call(func, _a);
+        }
 #else
-            FP::template call<typename FP::Arguments, typename FP::ReturnType>(method.func, _o, _a);
+        FP::template call<typename FP::Arguments, typename FP::ReturnType>(func, _o, _a);
 #endif
-        }
+    }
+
+    /// Entry of the table used to dispatch QMetaObject::InvokeMetaMethod: the method pointers are
+    /// data, and the code to call them is shared between methods with the same signature.
+    template <typename T>
+    struct MethodInvoker {
+        void (*invoke)(T *, const void *, void **);
+        const void *func;
+    };
+    template <typename T, int I>
+    static constexpr MethodInvoker<T> methodInvoker() {
+        using ObjI = typename T::W_MetaObjectCreatorHelper::ObjectInfo;
+        using Method = decltype(ObjI::method(index<I>));
+        return { &invokeMethod<T, typename Method::Func, typename Method::ArgSequence>, &MethodFunc<T, I>::value };
+    }
+
+    /// Dispatch QMetaObject::InvokeMetaMethod through a table indexed by id,
+    /// so the cost does not depend on the number of methods.
+    template <typename T, size_t... MethI>
+    static void invokeMethodById(T *_o, int _id, void **_a, std::index_sequence<MethI...>) {
+        // the extra entry avoids a zero-sized array
+        static constexpr MethodInvoker<T> invokers[] = { methodInvoker<T, int(MethI)>()..., {} };
+        if (uint(_id) < sizeof...(MethI))
+            invokers[_id].invoke(_o, invokers[_id].func, _a);
     }
 
     /// Helper for implementation of qt_static_metacall for QMetaObject::RegisterMethodArgumentMetaType
@@ -1226,30 +1631,164 @@ QT_WARNING_POP
         }
     }
 
-    /// Helper for implementation of qt_static_metacall for any of the operations in a property
-    /// T is the class, and I is the index of a property.
     template<typename T, int I>
-    static void propertyOperation(T *_o, QMetaObject::Call _c, int _id, void **_a) {
-        if (_id != I)
+    using IsCachedProperty = std::integral_constant<bool,
+        (PropertyInfoType<T, I>::flags & uint(PropertyFlags::Cached)) != 0>;
+
+    template<typename T>
+    static auto hasPropertyCache(T *o, int) -> std::is_same<typename decltype(o->w_propertyCache)::Object, T>;
+    template<typename T>
+    static std::false_type hasPropertyCache(T *, ...);
+
+    /// The value of the W_CACHED property I of _o, from the getter if it is not cached yet
+    template<typename T, int I>
+    static const PropertyType<T, I> &cachedPropertyValue(T *_o) {
+        static_assert(decltype(hasPropertyCache<T>(_o, 0))::value,
+                      "W_CACHED properties need W_CACHED_PROPERTIES in their class");
+        static_assert(size_t(I) < decltype(_o->w_propertyCache)::count,
+                      "W_CACHED_PROPERTIES must be after all the W_PROPERTY of the class");
+        auto &cached = _o->w_propertyCache.template value<I>();
+        if (!cached.valid) {
+            cached.value = propertyValue<T, I>(_o, std::false_type{});
+            cached.valid = true;
+        }
+        return cached.value;
+    }
+
+    template<typename T>
+    static auto hasChangedProperties(T *o, int) -> std::is_same<typename decltype(o->w_changedProperties)::Object, T>;
+    template<typename T>
+    static std::false_type hasChangedProperties(T *, ...);
+
+    /// The storage of W_TRACK_PROPERTY_CHANGES in _o
+    template<typename T>
+    static auto &trackedProperties(const T *_o) {
+        static_assert(decltype(hasChangedProperties<T>(const_cast<T *>(_o), 0))::value,
+                      "The class needs W_TRACK_PROPERTY_CHANGES");
+        return _o->w_changedProperties;
+    }
+
+    /// The set of changed properties of _o, for w_cpp::changedProperties
+    template<typename T>
+    static auto &changedProperties(const T *_o) { return trackedProperties(_o).bits; }
+
+    /// Emits again a NOTIFY signal deferred by a PropertyTransaction, with the value of the
+    /// property P as argument if the signal takes one
+    template<typename T, int P, typename R, typename C>
+    static void emitNotifySignal(T *_o, R (C::*signal)()) { (_o->*signal)(); }
+    template<typename T, int P, typename R, typename C>
+    static void emitNotifySignal(T *_o, R (C::*signal)() const) { (_o->*signal)(); }
+    template<typename T, int P, typename R, typename C, typename A>
+    static void emitNotifySignal(T *_o, R (C::*signal)(A)) { (_o->*signal)(propertyValue<T, P>(_o)); }
+    template<typename T, int P, typename R, typename C, typename A>
+    static void emitNotifySignal(T *_o, R (C::*signal)(A) const) { (_o->*signal)(propertyValue<T, P>(_o)); }
+
+    template<typename T, int SigIdx, typename Bits>
+    static void emitDeferredSignal(T *, const Bits &, std::false_type) {}
+    template<typename T, int SigIdx, typename Bits>
+    static void emitDeferredSignal(T *_o, const Bits &deferred, std::true_type) {
+        using Info = typename std::decay_t<decltype(trackedProperties(_o))>::template SignalInfo<SigIdx>;
+        // the signal marks all the properties it notifies, so checking the first one is enough
+        if (deferred.test(size_t(Info::firstProperty))) {
+            emitNotifySignal<T, Info::firstProperty>(
+                _o, w_state(index<SigIdx>, SignalStateTag{}, static_cast<T**>(nullptr)).func);
+        }
+    }
+    template<typename T, typename Bits, size_t... SigIdx>
+    static void emitDeferredSignals(T *_o, const Bits &deferred, index_sequence<SigIdx...>) {
+        using Tracker = std::decay_t<decltype(trackedProperties(_o))>;
+        ordered2<int>({(emitDeferredSignal<T, SigIdx>(_o, deferred,
+            std::integral_constant<bool, Tracker::template SignalInfo<SigIdx>::deferrable>{}), 0)...});
+    }
+
+    template<typename T>
+    static void beginPropertyTransaction(T *_o) { ++trackedProperties(_o).transactionDepth; }
+
+    /// Ends a PropertyTransaction on _o. When it is the outermost one, emits once each NOTIFY signal
+    /// that was deferred, in the order of their declaration, or aggregatedSignal if it is not null.
+    template<typename T>
+    static void endPropertyTransaction(T *_o, void (T::*aggregatedSignal)(const QBitArray &)) {
+        auto &tracker = trackedProperties(_o);
+        if (--tracker.transactionDepth > 0 || !tracker.deferred.any())
             return;
+        const auto deferred = tracker.deferred;
+        tracker.deferred.reset();
+        if (aggregatedSignal) {
+            QBitArray changed(int(deferred.size()));
+            for (int i : deferred)
+                changed.setBit(i);
+            (_o->*aggregatedSignal)(changed);
+        } else {
+            emitDeferredSignals(_o, deferred,
+                make_index_sequence<T::W_MetaObjectCreatorHelper::ObjectInfo::signalCount>{});
+        }
+    }
+
+    /// Read or write the property I of the object _o of class T, with its getter, setter or member.
+    /// Used by propertyOperation and by w_cpp::getProperty (propertyValue) and w_cpp::setProperty.
+    template<typename T, int I>
+    static void readProperty(T *_o, PropertyType<T, I> &value) {
+        readProperty<T, I>(_o, value, IsCachedProperty<T, I>{});
+    }
+    template<typename T, int I>
+    static void readProperty(T *_o, PropertyType<T, I> &value, std::true_type) {
+        value = cachedPropertyValue<T, I>(_o);
+    }
+    template<typename T, int I>
+    static void readProperty(T *_o, PropertyType<T, I> &value, std::false_type) {
+        Q_UNUSED(_o)
+        using TPP = T**;
+        constexpr auto p = w_state(index<I>, PropertyStateTag{}, TPP{});
+        if W_IF_CONSTEXPR (p.getter != nullptr) {
+            propGet(p.getter, _o, value);
+        } else if W_IF_CONSTEXPR (p.member != nullptr) {
+            propGet(p.member, _o, value);
+        }
+    }
+    /// 'value' is a PropertyType<T, I>, moved into the setter or the member if it is an rvalue.
+    template<typename T, int I, typename V>
+    static void writeProperty(T *_o, V &&value) {
+        Q_UNUSED(_o)
+        using TPP = T**;
+        constexpr auto p = w_state(index<I>, PropertyStateTag{}, TPP{});
+        if W_IF_CONSTEXPR (p.setter != nullptr) {
+            propSet(p.setter, _o, std::forward<V>(value));
+        } else if W_IF_CONSTEXPR (p.member != nullptr) {
+            using Compare = std::integral_constant<bool, !(p.flags & uint(PropertyFlags::NoCompare))>;
+            if (propSetIfChanged(Compare{}, p.member, _o, std::forward<V>(value)))
+                propNotify(p.notify, p.member, _o);
+        }
+    }
+    template<typename T, int I>
+    static PropertyType<T, I> propertyValue(T *_o) {
+        return propertyValue<T, I>(_o, IsCachedProperty<T, I>{});
+    }
+    template<typename T, int I>
+    static PropertyType<T, I> propertyValue(T *_o, std::true_type) {
+        return cachedPropertyValue<T, I>(_o);
+    }
+    template<typename T, int I>
+    static PropertyType<T, I> propertyValue(T *_o, std::false_type) {
+        using TPP = T**;
+        constexpr auto p = w_state(index<I>, PropertyStateTag{}, TPP{});
+        return propValue<PropertyType<T, I>>(p.getter, p.member, _o);
+    }
+
+    /// Helper for implementation of qt_static_metacall for any of the operations in a property
+    /// T is the class, I is the index of a property, and C the operation.
+    template<typename T, int I, QMetaObject::Call C>
+    static void propertyOperation(T *_o, void **_a) {
+        Q_UNUSED(_o)
         using TPP = T**;
         constexpr auto p = w_state(index<I>, PropertyStateTag{}, TPP{});
         using Type = typename decltype(p)::PropertyType;
-        switch(+_c) {
+        switch(+C) {
         case QMetaObject::ReadProperty:
-            if W_IF_CONSTEXPR (p.getter != nullptr) {
-                propGet(p.getter, _o, *reinterpret_cast<Type*>(_a[0]));
-            } else if W_IF_CONSTEXPR (p.member != nullptr) {
-                propGet(p.member, _o, *reinterpret_cast<Type*>(_a[0]));
-            }
+            readProperty<T, I>(_o, *reinterpret_cast<Type*>(_a[0]));
             break;
         case QMetaObject::WriteProperty:
-            if W_IF_CONSTEXPR (p.setter != nullptr) {
-                propSet(p.setter, _o, *reinterpret_cast<Type*>(_a[0]));
-            } else if W_IF_CONSTEXPR (p.member != nullptr) {
-                propSet(p.member, _o, *reinterpret_cast<Type*>(_a[0]));
-                propNotify(p.notify, p.member, _o);
-            }
+            // Not moved: like with moc, the value may belong to the caller (QML, Qt D-Bus, ...)
+            writeProperty<T, I>(_o, *reinterpret_cast<const Type*>(_a[0]));
             break;
         case QMetaObject::ResetProperty:
             if W_IF_CONSTEXPR (p.reset != nullptr) {
@@ -1258,24 +1797,92 @@ QT_WARNING_POP
             break;
         case QMetaObject::RegisterPropertyMetaType:
             *reinterpret_cast<int*>(_a[0]) = QtPrivate::QMetaTypeIdHelper<Type>::qt_metatype_id();
+            break;
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+        case QMetaObject::BindableProperty:
+            if W_IF_CONSTEXPR (p.bindable != nullptr) {
+                propBindable(p.bindable, _o, *reinterpret_cast<QUntypedBindable *>(_a[0]));
+            }
+            break;
+#endif
         }
     }
 
-    /// Helper for implementation of qt_static_metacall for QMetaObject::CreateInstance
-    /// T is the class, and I is the index of a constructor.
+    /// Dispatch a property metacall through a table of propertyOperation indexed by
+    /// [property][propertyMetacallKind], so the cost does not depend on the number of properties.
+    template<typename T, size_t... PropI>
+    static void propertyOperationById(T *_o, QMetaObject::Call _c, int _id, void **_a, std::index_sequence<PropI...>) {
+        using Operation = void (*)(T *, void **);
+        // the extra row avoids a zero-sized array
+        static constexpr Operation operations[][propertyMetacallKindCount] = {
+            { &propertyOperation<T, int(PropI), QMetaObject::ReadProperty>,
+              &propertyOperation<T, int(PropI), QMetaObject::WriteProperty>,
+              &propertyOperation<T, int(PropI), QMetaObject::ResetProperty>,
+              &propertyOperation<T, int(PropI), QMetaObject::RegisterPropertyMetaType>,
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+              &propertyOperation<T, int(PropI), QMetaObject::BindableProperty>,
+#endif
+            }...,
+            {} };
+        const int kind = propertyMetacallKind(_c);
+        if (uint(_id) < sizeof...(PropI) && kind >= 0)
+            operations[_id][kind](_o, _a);
+    }
+
+    /// Helper for implementation of qt_static_metacall for QMetaObject::CreateInstance and
+    /// QMetaObject::ConstructInPlace. T is the class, and I is the index of a constructor.
+    /// The object is constructed in 'storage', or allocated with new if 'storage' is null.
     template<typename T, class... Args, std::size_t... I>
-    static void createInstanceImpl(void **_a, const MetaConstructorInfo<Args...>&, index_sequence<I...>) {
-        *reinterpret_cast<T**>(_a[0]) =
-            new T(*reinterpret_cast<std::remove_reference_t<Args> *>(_a[I+1])...);
+    static T *constructImpl(void *storage, void **_a, const MetaConstructorInfo<Args...>&, index_sequence<I...>) {
+        if (storage)
+            return new (storage) T(*reinterpret_cast<std::remove_reference_t<Args> *>(_a[I+1])...);
+        return new T(*reinterpret_cast<std::remove_reference_t<Args> *>(_a[I+1])...);
     }
     template<typename T, int I>
-    static void createInstance(int _id, void** _a) {
-        if (_id == I) {
-            using TPP = T**;
-            constexpr auto m = w_state(index<I>, ConstructorStateTag{}, TPP{});
-            createInstanceImpl<T>(_a, m, m.argSequence);
-        }
+    static T *construct(void *storage, void **_a) {
+        using TPP = T**;
+        constexpr auto m = w_state(index<I>, ConstructorStateTag{}, TPP{});
+        return constructImpl<T>(storage, _a, m, m.argSequence);
+    }
+
+    /// The constructors of T, computed from its w_state so it can be used in any translation unit.
+    template<typename T>
+    static constexpr auto constructorSequence() {
+        return make_index_sequence<stateCount<1024*1024*1024, ConstructorStateTag, T**>>{};
+    }
+
+    /// Dispatch the construction through a table indexed by the constructor index, so the cost
+    /// does not depend on the number of constructors. Returns nullptr if there is no such constructor.
+    template<typename T, size_t... ConsI>
+    static T *constructById(int _id, void *storage, void **_a, std::index_sequence<ConsI...>) {
+        using Constructor = T *(*)(void *, void **);
+        // the extra entry avoids a zero-sized array
+        static constexpr Constructor constructors[] = { &construct<T, int(ConsI)>..., nullptr };
+        if (uint(_id) >= sizeof...(ConsI))
+            return nullptr;
+        return constructors[_id](storage, _a);
+    }
+
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+    /// Whether T itself (and not only one of its base classes) uses W_NAME_INDEX
+    template<typename T>
+    static auto hasNameIndex(int) -> std::is_same<typename T::w_NameIndexType, T>;
+    template<typename T>
+    static std::false_type hasNameIndex(...);
+
+    /// Gives the NameIndex of T for a PropertyNameIndexCall or a MethodNameIndexCall.
+    /// The tables are only built for the classes using W_NAME_INDEX: the other ones give no
+    /// NameIndex, and w_cpp::indexOfProperty and w_cpp::indexOfMethod let Qt look them up.
+    template<typename T>
+    static void nameIndexCall(int _id, void **_a, std::true_type) {
+        if (_id == PropertyNameIndexCall)
+            *reinterpret_cast<NameIndex *>(_a[0]) = PropertyNameTableOf<T>::value.nameIndex();
+        else if (_id == MethodNameIndexCall)
+            *reinterpret_cast<NameIndex *>(_a[0]) = MethodNameTableOf<T>::value.nameIndex();
     }
+    template<typename T>
+    static void nameIndexCall(int, void **, std::false_type) {}
+#endif
 
     /// Implementation of qt_static_metacall for W_OBJECT_IMPL which should be called with
     /// std::index_sequence for the amount of method, constructor, and properties.
@@ -1285,11 +1892,7 @@ QT_WARNING_POP
         Q_UNUSED(_id) Q_UNUSED(_o) Q_UNUSED(_a)
         if (_c == QMetaObject::InvokeMetaMethod) {
             Q_ASSERT(T::staticMetaObject.cast(_o));
-#if __cplusplus > 201700L
-            (invokeMethod<T, MethI>(reinterpret_cast<T*>(_o), _id, _a),...);
-#else
-            ordered((invokeMethod<T, MethI>(reinterpret_cast<T*>(_o), _id, _a),0)...);
-#endif
+            invokeMethodById(reinterpret_cast<T*>(_o), _id, _a, std::index_sequence<MethI...>{});
         } else if (_c == QMetaObject::RegisterMethodArgumentMetaType) {
 #if __cplusplus > 201700L
             (registerMethodArgumentType<T,MethI>(_id, _a),...);
@@ -1297,25 +1900,21 @@ QT_WARNING_POP
             ordered((registerMethodArgumentType<T,MethI>(_id, _a),0)...);
 #endif
         } else if (_c == QMetaObject::IndexOfMethod) {
-#if __cplusplus > 201700L
-            *reinterpret_cast<int *>(_a[0]) = ((1+indexOfMethod<T,MethI>(reinterpret_cast<void **>(_a[1]))) + ... + 0)-1;
-#else
-            auto r = int{-1};
-            ordered2<int>({(r += (1+indexOfMethod<T,MethI>(reinterpret_cast<void **>(_a[1]))))...});
-            *reinterpret_cast<int *>(_a[0]) = r;
-#endif
+            using ObjI = typename T::W_MetaObjectCreatorHelper::ObjectInfo;
+            *reinterpret_cast<int *>(_a[0]) = indexOfSignal<T>(reinterpret_cast<void **>(_a[1]), ObjI::signalSequence);
         } else if (_c == QMetaObject::CreateInstance) {
-#if __cplusplus > 201700L
-            (createInstance<T, ConsI>(_id, _a),...);
-#else
-            ordered((createInstance<T, ConsI>(_id, _a),0)...);
+            if (T *o = constructById<T>(_id, nullptr, _a, std::index_sequence<ConsI...>{}))
+                *reinterpret_cast<T**>(_a[0]) = o;
+#if QT_VERSION >= QT_VERSION_CHECK(6,5,0)
+        } else if (_c == QMetaObject::ConstructInPlace) {
+            constructById<T>(_id, _a[0], _a, std::index_sequence<ConsI...>{});
 #endif
-        } else if (isPropertyMetacall(_c)) {
-#if __cplusplus > 201700L
-            (propertyOperation<T,PropI>(static_cast<T*>(_o), _c, _id, _a),...);
-#else
-            ordered((propertyOperation<T,PropI>(static_cast<T*>(_o), _c, _id, _a),0)...);
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+        } else if (_c == QMetaObject::CustomCall) {
+            nameIndexCall<T>(_id, _a, decltype(hasNameIndex<T>(0)){});
 #endif
+        } else if (isPropertyMetacall(_c)) {
+            propertyOperationById(static_cast<T*>(_o), _c, _id, _a, std::index_sequence<PropI...>{});
         }
     }
 
@@ -1325,11 +1924,7 @@ QT_WARNING_POP
                             std::index_sequence<MethI...>, std::index_sequence<ConsI...>, std::index_sequence<PropI...>) {
         Q_UNUSED(_id) Q_UNUSED(_o) Q_UNUSED(_a)
         if (_c == QMetaObject::InvokeMetaMethod) {
-#if __cplusplus > 201700L
-            (invokeMethod<T, MethI>(_o, _id, _a),...);
-#else
-            ordered((invokeMethod<T, MethI>(_o, _id, _a), 0)...);
-#endif
+            invokeMethodById(_o, _id, _a, std::index_sequence<MethI...>{});
         } else if (_c == QMetaObject::RegisterMethodArgumentMetaType) {
 #if __cplusplus > 201700L
             (registerMethodArgumentType<T,MethI>(_id, _a),...);
@@ -1339,17 +1934,18 @@ QT_WARNING_POP
         } else if (_c == QMetaObject::IndexOfMethod) {
             Q_ASSERT_X(false, "qt_static_metacall", "IndexOfMethod called on a Q_GADGET");
         } else if (_c == QMetaObject::CreateInstance) {
-#if __cplusplus > 201700L
-            (createInstance<T, ConsI>(_id, _a),...);
-#else
-            ordered((createInstance<T, ConsI>(_id, _a), 0)...);
+            if (T *o = constructById<T>(_id, nullptr, _a, std::index_sequence<ConsI...>{}))
+                *reinterpret_cast<T**>(_a[0]) = o;
+#if QT_VERSION >= QT_VERSION_CHECK(6,5,0)
+        } else if (_c == QMetaObject::ConstructInPlace) {
+            constructById<T>(_id, _a[0], _a, std::index_sequence<ConsI...>{});
 #endif
-        } else if (isPropertyMetacall(_c)) {
-#if __cplusplus > 201700L
-            (propertyOperation<T,PropI>(_o, _c, _id, _a),...);
-#else
-            ordered((propertyOperation<T,PropI>(_o, _c, _id, _a), 0)...);
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+        } else if (_c == QMetaObject::CustomCall) {
+            nameIndexCall<T>(_id, _a, decltype(hasNameIndex<T>(0)){});
 #endif
+        } else if (isPropertyMetacall(_c)) {
+            propertyOperationById(_o, _c, _id, _a, std::index_sequence<PropI...>{});
         }
     }
 
@@ -1365,22 +1961,22 @@ QT_WARNING_POP
     static void* qt_metacast_impl(T *o, const char *_clname) {
         if (!_clname)
             return nullptr;
-#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
-        using MetaData = MetaDataBuilder<T, make_index_sequence<dataLayout<T>.stringCount>>;
-        if (!strcmp(_clname, MetaData::meta_data.stringChars.data))
-            return o;
-#else
-        const QByteArrayDataPtr sd = { const_cast<QByteArrayData*>(T::staticMetaObject.d.stringdata) };
-        if (_clname == QByteArray(sd))
-            return o;
-#endif
+        const MetaCastKey key = makeMetaCastKey(_clname);
         using ObjI = typename T::W_MetaObjectCreatorHelper::ObjectInfo;
+        constexpr auto name = ObjI::name;
+        constexpr uint nameHash = metaCastHash(name.b, name.e);
+        if (key.hash == nameHash && key.size == size_t(name.size()) && !memcmp(_clname, name.b, key.size))
+            return o;
         void *result = {};
         auto l = [&](auto i) {
             using TPP = T**;
             using Interface = decltype(w_state(i, InterfaceStateTag{}, TPP{}));
             const char *iid = qobject_interface_iid<Interface>();
-            if (iid && !strcmp(_clname, iid))
+            if (!iid || result)
+                return;
+            static const MetaCastKey iidKey = makeMetaCastKey(iid);
+            if (_clname == iid // the IID literal is usually the pointer given to qobject_cast
+                || (key.hash == iidKey.hash && key.size == iidKey.size && !memcmp(_clname, iid, key.size)))
                 result = static_cast<Interface>(o);
         };
         fold(ObjI::interfaceSequence, l);
@@ -1392,6 +1988,439 @@ QT_WARNING_POP
 
 } // namespace w_internal
 
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+namespace w_internal {
+/// Whether the method at 'methodData' in the data of 'm' has the parameter types of the normalized
+/// 'params' (e.g. "(int,QString)"). The type names are read from the data of the metaobject, so
+/// unlike with QMetaMethod::methodSignature, no QByteArray is built for the comparison.
+inline bool parameterTypesMatch(const QMetaObject *m, const uint *methodData, QByteArrayView params) {
+    if (params.size() < 2 || params.data()[params.size() - 1] != ')')
+        return false;
+    const char *p = params.data() + 1; // after the '('
+    const char *const end = params.data() + params.size() - 1;
+    const uint argc = methodData[1];
+    const uint *types = m->d.data + methodData[2] + 1; // after the return type
+    for (uint a = 0; a < argc; ++a) {
+        const char *typeName;
+        size_t length;
+        if (types[a] & IsUnresolvedType) {
+            const uint index = types[a] & ~IsUnresolvedType;
+            typeName = reinterpret_cast<const char *>(m->d.stringdata) + m->d.stringdata[2 * index];
+            length = m->d.stringdata[2 * index + 1];
+        } else {
+            typeName = QMetaType(int(types[a])).name();
+            length = typeName ? strlen(typeName) : 0;
+        }
+        if (size_t(end - p) < length || memcmp(p, typeName, length) != 0)
+            return false;
+        p += length;
+        if (a + 1 < argc && *p++ != ',')
+            return false;
+    }
+    return p == end;
+}
+
+/// Finds the last method of 'mo' or of its base classes that has the normalized 'signature' (or the
+/// name 'signature' when 'nameOnly' is set) and whose type is 'type' (any type if it is -1)
+inline int indexOfMethod(const QMetaObject *mo, QByteArrayView signature, int type, bool nameOnly) {
+    const char *paren = nameOnly ? nullptr
+            : static_cast<const char *>(memchr(signature.data(), '(', size_t(signature.size())));
+    if (!nameOnly && !paren)
+        return -1;
+    const size_t nameLength = paren ? size_t(paren - signature.data()) : size_t(signature.size());
+    for (const QMetaObject *m = mo; m; m = m->superClass()) {
+        NameIndex nameIndex{};
+        void *argv[] = { &nameIndex };
+        if (m->d.static_metacall)
+            m->d.static_metacall(nullptr, QMetaObject::CustomCall, MethodNameIndexCall, argv);
+        if (nameIndex.names) {
+            // The table already compared the names: only the type and the parameters are left
+            const int offset = m->methodOffset();
+            const uint *methods = m->d.data + m->d.data[5]; // 6 ints per method (see generateDataPass)
+            int found = -1;
+            for (int i = nameIndex.find(signature.data(), nameLength); i >= 0; i = nameIndex.next[i]) {
+                if (type >= 0 && int(m->method(i + offset).methodType()) != type)
+                    continue;
+                if (nameOnly || parameterTypesMatch(m, methods + 6 * i,
+                        QByteArrayView(paren, signature.size() - qsizetype(nameLength))))
+                    found = i; // Like Qt, the last declared method wins
+            }
+            if (found >= 0)
+                return found + offset;
+        } else if (!nameOnly) { // not a verdigris class, or without W_NAME_INDEX: Qt looks up this class and its bases
+            const QByteArray sig = signature.toByteArray();
+            return type == QMetaMethod::Signal ? m->indexOfSignal(sig.constData())
+                 : type == QMetaMethod::Slot ? m->indexOfSlot(sig.constData())
+                 : m->indexOfMethod(sig.constData());
+        } else {
+            for (int i = m->methodCount() - 1; i >= m->methodOffset(); --i) {
+                const QMetaMethod method = m->method(i);
+                if (QByteArrayView(method.name()) == signature
+                        && (type < 0 || int(method.methodType()) == type))
+                    return i;
+            }
+        }
+    }
+    return -1;
+}
+} // namespace w_internal
+#endif
+
+#ifndef Q_CC_MSVC
+namespace w_internal {
+/// The index, among the states of T with the tag 'Tag', of the method whose IntegralConstant is IC
+/// (declared for a given pointer to member function), or -1
+template<typename T, typename Tag, typename IC, size_t... I>
+constexpr int stateIndexOfMethod(std::index_sequence<I...>) {
+    int r = -1;
+    ordered2<int>({(std::is_same<typename decltype(w_state(index<I>, Tag{}, static_cast<T**>(nullptr)))::IntegralConstant,
+                                 IC>::value ? (r = int(I)) : 0)...});
+    return r;
+}
+
+/// The index in the method list of T of the signal, slot or invokable method that was declared
+/// for the pointer to member function F, or -1
+template<typename T, typename F, F f>
+constexpr int methodIndexOf() {
+    using IC = std::integral_constant<F, f>;
+    constexpr size_t L = 1024*1024*1024;
+    constexpr int signalCount = stateCount<L, SignalStateTag, T**>;
+    constexpr int slotCount = stateCount<L, SlotStateTag, T**>;
+    constexpr int methodCount = stateCount<L, MethodStateTag, T**>;
+    constexpr int signalIndex = stateIndexOfMethod<T, SignalStateTag, IC>(make_index_sequence<signalCount>{});
+    constexpr int slotIndex = stateIndexOfMethod<T, SlotStateTag, IC>(make_index_sequence<slotCount>{});
+    constexpr int methodIndex = stateIndexOfMethod<T, MethodStateTag, IC>(make_index_sequence<methodCount>{});
+    return signalIndex >= 0 ? signalIndex
+         : slotIndex >= 0 ? signalCount + slotIndex
+         : methodIndex >= 0 ? signalCount + slotCount + methodIndex
+         : -1;
+}
+
+#if QT_VERSION >= QT_VERSION_CHECK(6,5,0)
+/// Queues the invocation of 'method' with the arguments converted to the types of its parameters,
+/// so that their metatypes are known at compile time.
+template<typename ParamList> struct QueuedInvoker;
+template<typename... Params> struct QueuedInvoker<QtPrivate::List<Params...>> {
+    static bool invoke(const QMetaMethod &method, QObject *obj, Qt::ConnectionType type,
+                       const std::decay_t<Params> &... args) {
+        return method.invoke(obj, type, args...);
+    }
+};
+#endif
+} // namespace w_internal
+#endif
+
+namespace w_cpp {
+
+/// Constructs an object of class T in 'storage' with its W_CONSTRUCTOR of index 'constructorIndex'.
+/// This is what QMetaObject::newInstance does, without allocating: 'storage' must be large enough
+/// and suitably aligned for T. As for qt_static_metacall, args[1], args[2], ... are the addresses
+/// of the arguments, and args[0] is not used.
+/// Returns the object, or nullptr if there is no such constructor. The object must be destroyed
+/// by calling its destructor (see destroyInstance), so it must not get a parent that would delete it.
+template<typename T>
+T *constructInPlace(void *storage, int constructorIndex, void **args) {
+    using w_internal::FriendHelper;
+    return FriendHelper::constructById<T>(constructorIndex, storage, args, FriendHelper::constructorSequence<T>());
+}
+
+/// Same as constructInPlace, but the storage is allocated with 'allocator' (for example, an object pool).
+/// The storage is given back to the allocator if there is no such constructor or if it throws.
+template<typename T, typename Allocator>
+T *createInstance(Allocator &allocator, int constructorIndex, void **args) {
+    using Traits = typename std::allocator_traits<Allocator>::template rebind_traits<T>;
+    typename Traits::allocator_type alloc(allocator);
+    T *storage = Traits::allocate(alloc, 1);
+    T *result = nullptr;
+    QT_TRY {
+        result = constructInPlace<T>(storage, constructorIndex, args);
+    } QT_CATCH(...) {
+        Traits::deallocate(alloc, storage, 1);
+        QT_RETHROW;
+    }
+    if (!result)
+        Traits::deallocate(alloc, storage, 1);
+    return result;
+}
+
+/// Destroys an object created with createInstance and gives its storage back to 'allocator'.
+template<typename T, typename Allocator>
+void destroyInstance(Allocator &allocator, T *object) {
+    using Traits = typename std::allocator_traits<Allocator>::template rebind_traits<T>;
+    typename Traits::allocator_type alloc(allocator);
+    object->~T();
+    Traits::deallocate(alloc, object, 1);
+}
+
+/// Index of the property 'name' of T, relative to T::staticMetaObject.propertyOffset().
+/// Only the properties declared in T itself are considered, not the ones of its base classes.
+/// When evaluated at compile time, a name that is not a property of T is a compile error.
+/// Example: `constexpr int idx = w_cpp::propertyIndex<MyObject>("opacity");`
+template<typename T, size_t N>
+constexpr int propertyIndex(const char (&name)[N]) {
+    using Sequence = w_internal::make_index_sequence<w_internal::stateCount<1024*1024*1024, w_internal::PropertyStateTag, T**>>;
+    return w_internal::indexOfPropertyName<T>(name, N - 1, Sequence{}) >= 0
+        ? w_internal::indexOfPropertyName<T>(name, N - 1, Sequence{})
+        : w_internal::propertyNameNotFound();
+}
+
+/// Reads the property of index I of T by calling its getter or reading its member directly,
+/// without QVariant and without looking up the name.
+/// Example: `double o = w_cpp::getProperty<MyObject, w_cpp::propertyIndex<MyObject>("opacity")>(obj);`
+/// The value is returned directly from the getter, without default constructing and assigning it.
+template<typename T, int I>
+w_internal::PropertyType<T, I> getProperty(const T *obj) {
+    return w_internal::FriendHelper::propertyValue<T, I>(const_cast<T *>(obj));
+}
+
+/// Writes the property of index I of T by calling its setter, or by assigning its member and
+/// emitting its notify signal, without QVariant and without looking up the name.
+/// A temporary value is moved into a setter taking its argument by value or by rvalue reference.
+template<typename T, int I>
+void setProperty(T *obj, const w_internal::PropertyType<T, I> &value) {
+    w_internal::FriendHelper::writeProperty<T, I>(obj, value);
+}
+template<typename T, int I>
+void setProperty(T *obj, w_internal::PropertyType<T, I> &&value) {
+    w_internal::FriendHelper::writeProperty<T, I>(obj, std::move(value));
+}
+
+/// The properties declared in T whose NOTIFY signal was emitted since the object was created or
+/// since the last call to takeChangedProperties. T must use W_TRACK_PROPERTY_CHANGES.
+/// The indices are relative to T::staticMetaObject.propertyOffset(), like for getProperty.
+/// Example: `for (int i : w_cpp::changedProperties(obj)) sync(obj->metaObject()->property(offset + i));`
+template<typename T>
+auto changedProperties(const T *obj) -> const std::decay_t<decltype(w_internal::FriendHelper::changedProperties(obj))> & {
+    return w_internal::FriendHelper::changedProperties(obj);
+}
+
+/// Returns the changed properties of obj, like changedProperties, and clears them.
+template<typename T>
+auto takeChangedProperties(T *obj) -> std::decay_t<decltype(w_internal::FriendHelper::changedProperties(obj))> {
+    auto &bits = w_internal::FriendHelper::changedProperties(obj);
+    auto result = bits;
+    bits.reset();
+    return result;
+}
+
+/// Defers the NOTIFY signals of the properties of an object while it exists, to write many
+/// properties at once without running the code connected to their signals after each write.
+/// The class T must use W_TRACK_PROPERTY_CHANGES. The NOTIFY signals of the properties declared in T
+/// are not emitted while a transaction is open on the object, whether they come from a MEMBER
+/// property being written or from a setter. When the (outermost) transaction ends, each of these
+/// signals is emitted once, after all the writes, with the current value of the property if it
+/// takes it as argument. Signals with more arguments are not deferred.
+/// Alternatively, a signal taking a QBitArray can be given, which is then emitted once instead,
+/// with the bits of the changed properties set (relative to T::staticMetaObject.propertyOffset()).
+/// Use it in the thread of the object.
+/// Example:
+/// \code
+/// {
+///     w_cpp::PropertyTransaction<MyObject> transaction(obj);
+///     obj->setWidth(w);
+///     obj->setHeight(h); // geometryChanged is emitted once, at the end of the scope
+/// }
+/// \endcode
+template<typename T>
+class PropertyTransaction {
+    T *obj;
+    void (T::*aggregatedSignal)(const QBitArray &);
+public:
+    explicit PropertyTransaction(T *obj, void (T::*aggregatedSignal)(const QBitArray &) = nullptr)
+        : obj(obj), aggregatedSignal(aggregatedSignal)
+    { w_internal::FriendHelper::beginPropertyTransaction(obj); }
+    PropertyTransaction(const PropertyTransaction &) = delete;
+    PropertyTransaction &operator=(const PropertyTransaction &) = delete;
+    ~PropertyTransaction() { commit(); }
+
+    /// Ends the transaction before the end of the scope
+    void commit() {
+        if (!obj)
+            return;
+        T *o = obj;
+        obj = nullptr;
+        w_internal::FriendHelper::endPropertyTransaction(o, aggregatedSignal);
+    }
+};
+
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+/// Same as QMetaObject::indexOfProperty, but the properties of the classes of the hierarchy using
+/// W_NAME_INDEX are found with a perfect hash table built at compile time instead of comparing
+/// 'name' with each of their properties. The other classes are looked up by Qt.
+inline int indexOfProperty(const QMetaObject *mo, QByteArrayView name) {
+    for (const QMetaObject *m = mo; m; m = m->superClass()) {
+        w_internal::NameIndex nameIndex{};
+        void *argv[] = { &nameIndex };
+        if (m->d.static_metacall)
+            m->d.static_metacall(nullptr, QMetaObject::CustomCall, w_internal::PropertyNameIndexCall, argv);
+        if (!nameIndex.names) // not a verdigris class, or without W_NAME_INDEX
+            return m->indexOfProperty(name.toByteArray().constData());
+        const int i = nameIndex.find(name.data(), size_t(name.size()));
+        if (i >= 0)
+            return i + m->propertyOffset();
+    }
+    return -1;
+}
+
+/// Same as QMetaObject::indexOfMethod, indexOfSignal and indexOfSlot: the methods of the classes of
+/// the hierarchy using W_NAME_INDEX are found with a perfect hash table of their names built at
+/// compile time, and only the parameter types of the overloads of that name are compared with the
+/// signature. The other classes are looked up by Qt.
+/// The signature must be normalized (see QMetaObject::normalizedSignature).
+inline int indexOfMethod(const QMetaObject *mo, QByteArrayView signature) {
+    return w_internal::indexOfMethod(mo, signature, -1, false);
+}
+inline int indexOfSignal(const QMetaObject *mo, QByteArrayView signature) {
+    return w_internal::indexOfMethod(mo, signature, QMetaMethod::Signal, false);
+}
+inline int indexOfSlot(const QMetaObject *mo, QByteArrayView signature) {
+    return w_internal::indexOfMethod(mo, signature, QMetaMethod::Slot, false);
+}
+
+/// The index of the last declared method called 'name', whatever its arguments, or -1.
+/// Useful to invoke a method by name when it is not overloaded.
+inline int indexOfMethodByName(const QMetaObject *mo, QByteArrayView name) {
+    return w_internal::indexOfMethod(mo, name, -1, true);
+}
+#endif
+
+#if __cplusplus > 201700L && !defined(Q_CC_MSVC)
+/// Same as QMetaObject::invokeMethod, for the signal, slot or invokable method F (a pointer to a
+/// member function declared with W_SIGNAL, W_SLOT or W_INVOKABLE), without looking up its name.
+/// Direct calls call F. Queued calls post an event that invokes the method by its index, with the
+/// arguments converted to the parameter types of F, whose metatypes are known at compile time.
+/// The return value of F is discarded. Returns false if the method could not be invoked.
+/// Example: `w_cpp::invoke<&MyObject::setValue>(obj, Qt::QueuedConnection, 42);`
+template<auto F, typename... Args>
+bool invoke(typename QtPrivate::FunctionPointer<decltype(F)>::Object *obj, Qt::ConnectionType type,
+            Args &&... args) {
+    using FP = QtPrivate::FunctionPointer<decltype(F)>;
+    using Obj = typename FP::Object;
+    constexpr int methodIndex = w_internal::methodIndexOf<Obj, decltype(F), F>();
+    static_assert(methodIndex >= 0, "F must be declared with W_SIGNAL, W_SLOT or W_INVOKABLE");
+    static_assert(int(sizeof...(Args)) == int(FP::ArgumentCount), "Wrong number of arguments");
+    if (!obj)
+        return false;
+    if (type == Qt::AutoConnection)
+        type = obj->thread() == QThread::currentThread() ? Qt::DirectConnection : Qt::QueuedConnection;
+    if (type == Qt::DirectConnection) {
+        (obj->*F)(std::forward<Args>(args)...);
+        return true;
+    }
+#if QT_VERSION >= QT_VERSION_CHECK(6,5,0)
+    const QMetaObject *mo = &Obj::staticMetaObject;
+    return w_internal::QueuedInvoker<typename FP::Arguments>::invoke(
+        mo->method(mo->methodOffset() + methodIndex), obj, type, std::forward<Args>(args)...);
+#else
+    // QMetaMethod::invoke needs the names of the types before Qt 6.5: queue a functor instead
+    return QMetaObject::invokeMethod(obj, [obj, args...] { (obj->*F)(args...); }, type);
+#endif
+}
+#endif
+
+#ifndef Q_CC_MSVC
+/// Same as QObject::connect(sender, signal, receiver, slot, type), for a signal and a slot (or signal,
+/// or invokable method) declared with the verdigris macros. Their indices are computed at compile
+/// time, and the compatibility of their arguments is checked at compile time, so the connection is
+/// made by index: nothing is looked up when connecting.
+/// See also W_CONNECT, which deduces the types of the pointers to member functions.
+template<typename SignalF, SignalF Signal, typename SlotF, SlotF Slot>
+QMetaObject::Connection connect(const typename QtPrivate::FunctionPointer<SignalF>::Object *sender,
+                                const typename QtPrivate::FunctionPointer<SlotF>::Object *receiver,
+                                Qt::ConnectionType type = Qt::AutoConnection) {
+    using SignalType = QtPrivate::FunctionPointer<SignalF>;
+    using SlotType = QtPrivate::FunctionPointer<SlotF>;
+    using Sender = typename SignalType::Object;
+    using Receiver = typename SlotType::Object;
+    constexpr int signalIndex = w_internal::methodIndexOf<Sender, SignalF, Signal>();
+    constexpr int slotIndex = w_internal::methodIndexOf<Receiver, SlotF, Slot>();
+    static_assert(signalIndex >= 0 && signalIndex < w_internal::stateCount<1024*1024*1024, w_internal::SignalStateTag, Sender**>,
+                  "Signal must be declared with W_SIGNAL");
+    static_assert(slotIndex >= 0, "Slot must be declared with W_SLOT, W_INVOKABLE or W_SIGNAL");
+    static_assert(int(SignalType::ArgumentCount) >= int(SlotType::ArgumentCount),
+                  "The slot requires more arguments than the signal provides.");
+    static_assert((QtPrivate::CheckCompatibleArguments<typename SignalType::Arguments, typename SlotType::Arguments>::value),
+                  "Signal and slot arguments are not compatible.");
+    static const int signalOffset = Sender::staticMetaObject.methodOffset();
+    static const int slotOffset = Receiver::staticMetaObject.methodOffset();
+    const int *types = nullptr;
+    if (type == Qt::QueuedConnection || type == Qt::BlockingQueuedConnection)
+        types = QtPrivate::ConnectionTypes<typename SignalType::Arguments>::types();
+    return QMetaObject::connect(sender, signalOffset + signalIndex, receiver, slotOffset + slotIndex,
+                                type, const_cast<int *>(types));
+}
+
+/// Disconnects a connection made with w_cpp::connect or W_CONNECT
+template<typename SignalF, SignalF Signal, typename SlotF, SlotF Slot>
+bool disconnect(const typename QtPrivate::FunctionPointer<SignalF>::Object *sender,
+                const typename QtPrivate::FunctionPointer<SlotF>::Object *receiver) {
+    using Sender = typename QtPrivate::FunctionPointer<SignalF>::Object;
+    using Receiver = typename QtPrivate::FunctionPointer<SlotF>::Object;
+    constexpr int signalIndex = w_internal::methodIndexOf<Sender, SignalF, Signal>();
+    constexpr int slotIndex = w_internal::methodIndexOf<Receiver, SlotF, Slot>();
+    static_assert(signalIndex >= 0, "Signal must be declared with W_SIGNAL");
+    static_assert(slotIndex >= 0, "Slot must be declared with W_SLOT, W_INVOKABLE or W_SIGNAL");
+    static const int signalOffset = Sender::staticMetaObject.methodOffset();
+    static const int slotOffset = Receiver::staticMetaObject.methodOffset();
+    return QMetaObject::disconnect(sender, signalOffset + signalIndex, receiver, slotOffset + slotIndex);
+}
+
+#if __cplusplus > 201700L
+/// Same as above, with the pointers to member functions as template arguments (C++17)
+/// Example: `w_cpp::connect<&Sender::valueChanged, &Receiver::setValue>(sender, receiver);`
+template<auto Signal, auto Slot>
+QMetaObject::Connection connect(const typename QtPrivate::FunctionPointer<decltype(Signal)>::Object *sender,
+                                const typename QtPrivate::FunctionPointer<decltype(Slot)>::Object *receiver,
+                                Qt::ConnectionType type = Qt::AutoConnection) {
+    return connect<decltype(Signal), Signal, decltype(Slot), Slot>(sender, receiver, type);
+}
+template<auto Signal, auto Slot>
+bool disconnect(const typename QtPrivate::FunctionPointer<decltype(Signal)>::Object *sender,
+                const typename QtPrivate::FunctionPointer<decltype(Slot)>::Object *receiver) {
+    return disconnect<decltype(Signal), Signal, decltype(Slot), Slot>(sender, receiver);
+}
+#endif
+#endif
+
+#if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+/// A string literal that can be used as a template argument (C++20)
+template<size_t N>
+struct PropertyName {
+    char data[N] = {};
+    constexpr PropertyName(const char (&s)[N]) {
+        for (size_t i = 0; i < N; ++i)
+            data[i] = s[i];
+    }
+};
+
+/// Same as getProperty and setProperty, with the name of the property as template argument.
+/// Example: `w_cpp::setProperty<MyObject, "opacity">(obj, 0.5);`
+template<typename T, PropertyName Name>
+auto getProperty(const T *obj) {
+    return getProperty<T, propertyIndex<T>(Name.data)>(obj);
+}
+template<typename T, PropertyName Name>
+void setProperty(T *obj, const w_internal::PropertyType<T, propertyIndex<T>(Name.data)> &value) {
+    setProperty<T, propertyIndex<T>(Name.data)>(obj, value);
+}
+template<typename T, PropertyName Name>
+void setProperty(T *obj, w_internal::PropertyType<T, propertyIndex<T>(Name.data)> &&value) {
+    setProperty<T, propertyIndex<T>(Name.data)>(obj, std::move(value));
+}
+#endif
+
+} // namespace w_cpp
+
+#ifndef Q_CC_MSVC
+/// Connects like QObject::connect, with the indices of the signal and of the slot computed at
+/// compile time (see w_cpp::connect). Example:
+/// W_CONNECT(sender, &Sender::valueChanged, receiver, &Receiver::setValue);
+#define W_CONNECT(SENDER, SIGNAL, RECEIVER, SLOT) \
+    w_cpp::connect<decltype(SIGNAL), SIGNAL, decltype(SLOT), SLOT>(SENDER, RECEIVER)
+#define W_DISCONNECT(SENDER, SIGNAL, RECEIVER, SLOT) \
+    w_cpp::disconnect<decltype(SIGNAL), SIGNAL, decltype(SLOT), SLOT>(SENDER, RECEIVER)
+#endif
+
 #ifndef QT_INIT_METAOBJECT // Defined in qglobal.h since Qt 5.10
 #define QT_INIT_METAOBJECT
 #endif
@@ -0,0 +1,402 @@
+/****************************************************************************
+ *  Copyright (C) 2026 Woboq GmbH
+ *  Olivier Goffart <ogoffart at woboq.com>
+ *  https://woboq.com/
+ *
+ *  This file is part of Verdigris: a way to use Qt without moc.
+ *  https://github.com/woboq/verdigris
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+#include "wobjectdefs.h"
+#include <QtCore/qobject.h>
+#include <QtCore/qmetaobject.h>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <unordered_map>
+
+namespace w_internal {
+
+/// Thread-local pool for the pooled slot objects: the freed blocks are kept in a free list per
+/// size class (32, 64, 128 and 256 bytes) and reused by the next allocation of that class, so
+/// connecting and disconnecting again and again does not allocate.
+/// The blocks all come from operator new, so a block can be given back to the pool of any thread,
+/// or to operator delete when the free list is full or the pool of the thread is already destroyed.
+class SlotObjectPool {
+    struct FreeBlock { FreeBlock *next; };
+    static constexpr int classCount = 4;
+    static constexpr int maxFreeBlocks = 64; // per size class, the next freed blocks are deleted
+    FreeBlock *freeLists[classCount] = {};
+    int freeCounts[classCount] = {};
+
+    /// Set when the pool of the thread is destroyed. Trivially destructible, so that it can still
+    /// be read by the thread_local objects destroyed after the pool.
+    static bool &isDestroyed() {
+        static thread_local bool destroyed = false;
+        return destroyed;
+    }
+    /// The pool of the current thread, or null if it was already destroyed because the thread exits
+    static SlotObjectPool *local() {
+        if (isDestroyed())
+            return nullptr;
+        static thread_local SlotObjectPool pool;
+        return &pool;
+    }
+
+    SlotObjectPool() = default;
+    ~SlotObjectPool() {
+        isDestroyed() = true;
+        for (FreeBlock *&list : freeLists) {
+            while (FreeBlock *block = list) {
+                list = block->next;
+                ::operator delete(block);
+            }
+        }
+    }
+public:
+    static constexpr size_t blockSize(int sizeClass) { return size_t(32) << sizeClass; }
+    /// The size class of an object of 'size' bytes, or -1 if it is too big to be pooled
+    static constexpr int sizeClass(size_t size) {
+        return size <= 32 ? 0 : size <= 64 ? 1 : size <= 128 ? 2 : size <= 256 ? 3 : -1;
+    }
+
+    static void *allocate(int sizeClass) {
+        SlotObjectPool *pool = local();
+        if (FreeBlock *block = pool ? pool->freeLists[sizeClass] : nullptr) {
+            pool->freeLists[sizeClass] = block->next;
+            --pool->freeCounts[sizeClass];
+            return block;
+        }
+        return ::operator new(blockSize(sizeClass));
+    }
+    static void deallocate(void *p, int sizeClass) {
+        SlotObjectPool *pool = local();
+        if (!pool || pool->freeCounts[sizeClass] >= maxFreeBlocks) {
+            ::operator delete(p);
+            return;
+        }
+        FreeBlock *block = static_cast<FreeBlock *>(p);
+        block->next = pool->freeLists[sizeClass];
+        pool->freeLists[sizeClass] = block;
+        ++pool->freeCounts[sizeClass];
+    }
+};
+
+class PooledSlotDispatcher;
+
+/// A functor connected with w_cpp::connectPooled.
+/// Like QtPrivate::QSlotObjectBase, it is reference counted: it is referenced by its dispatcher
+/// while it is connected, and by the w_cpp::PooledConnection handles, and the last of them
+/// destroys it through its 'impl' function, which gives its memory back to the pool.
+class PooledSlotObject {
+public:
+    enum Operation { Destroy, Call };
+    using ImplFn = void (*)(int which, PooledSlotObject *self, void **args);
+
+    explicit PooledSlotObject(ImplFn impl) : m_impl(impl) {}
+    void ref() noexcept { m_ref.fetch_add(1, std::memory_order_relaxed); }
+    void destroyIfLastRef() noexcept {
+        if (m_ref.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            m_impl(Destroy, this, nullptr);
+    }
+    void call(void **args) { m_impl(Call, this, args); }
+    inline bool isConnected() const;
+
+    /// Null once disconnected. Atomic because the dispatcher may reset it in another thread than
+    /// the one of the sender when it is destroyed there (see PooledSlotDispatcher).
+    std::atomic<PooledSlotDispatcher *> dispatcher{nullptr};
+    PooledSlotObject *next = nullptr;
+private:
+    ImplFn m_impl;
+    std::atomic<int> m_ref{1};
+};
+
+/// The number of the first arguments of the signal (given as a std::tuple) that F can be called
+/// with: as many as possible, or -1 if F cannot be called with them
+template<typename F, typename ArgTuple, typename Seq, typename = void>
+struct IsCallableWithArguments : std::false_type {};
+template<typename F, typename... Args, size_t... I>
+struct IsCallableWithArguments<F, std::tuple<Args...>, std::index_sequence<I...>,
+        decltype(void(std::declval<F &>()(std::declval<const std::tuple_element_t<I, std::tuple<Args...>> &>()...)))>
+    : std::true_type {};
+template<typename F, typename ArgTuple, size_t N = std::tuple_size<ArgTuple>::value>
+struct CallableArgumentCount
+    : std::conditional_t<IsCallableWithArguments<F, ArgTuple, std::make_index_sequence<N>>::value,
+                         std::integral_constant<int, int(N)>, CallableArgumentCount<F, ArgTuple, N - 1>> {};
+template<typename F, typename ArgTuple>
+struct CallableArgumentCount<F, ArgTuple, 0>
+    : std::integral_constant<int, IsCallableWithArguments<F, ArgTuple, std::index_sequence<>>::value ? 0 : -1> {};
+
+/// The slot object for a functor of type F, connected to a signal with the arguments ArgList
+template<typename F, typename ArgList> class PooledFunctorSlot;
+template<typename F, typename... Args>
+class PooledFunctorSlot<F, QtPrivate::List<Args...>> : public PooledSlotObject {
+    using ArgTuple = std::tuple<std::decay_t<Args>...>;
+    static constexpr int argumentCount = CallableArgumentCount<F, ArgTuple>::value;
+    static_assert(argumentCount >= 0, "The functor cannot be called with the arguments of the signal.");
+
+    F function;
+
+    explicit PooledFunctorSlot(F &&f) : PooledSlotObject(&impl), function(std::move(f)) {}
+
+    static constexpr int sizeClass() {
+        return alignof(PooledFunctorSlot) <= alignof(std::max_align_t)
+            ? SlotObjectPool::sizeClass(sizeof(PooledFunctorSlot)) : -1;
+    }
+    template<size_t... I>
+    void callFunction(void **args, std::index_sequence<I...>) {
+        Q_UNUSED(args)
+        function(*static_cast<const std::tuple_element_t<I, ArgTuple> *>(args[I + 1])...);
+    }
+    static void impl(int which, PooledSlotObject *base, void **args) {
+        auto *self = static_cast<PooledFunctorSlot *>(base);
+        switch (which) {
+        case Destroy:
+            self->~PooledFunctorSlot();
+            if (sizeClass() >= 0)
+                SlotObjectPool::deallocate(self, sizeClass());
+            else
+                ::operator delete(self);
+            break;
+        case Call:
+            self->callFunction(args, std::make_index_sequence<argumentCount>{});
+            break;
+        }
+    }
+public:
+    static PooledSlotObject *create(F &&f) {
+        void *p = sizeClass() >= 0 ? SlotObjectPool::allocate(sizeClass())
+                                   : ::operator new(sizeof(PooledFunctorSlot));
+        QT_TRY {
+            return new (p) PooledFunctorSlot(std::move(f));
+        } QT_CATCH(...) {
+            if (sizeClass() >= 0)
+                SlotObjectPool::deallocate(p, sizeClass());
+            else
+                ::operator delete(p);
+            QT_RETHROW;
+        }
+    }
+};
+
+/// Calls the pooled slot objects connected to one signal of one sender. It is owned by the only
+/// QObject::connect made for that signal, so it is destroyed with that connection, which may be
+/// later than the sender: Qt keeps a reference to the slot object while it calls it, or while a
+/// queued call is pending. It may also be destroyed in another thread.
+class PooledSlotDispatcher {
+    PooledSlotObject *first = nullptr;
+    PooledSlotObject *last = nullptr;
+    int emitting = 0;
+    bool dirty = false;
+
+    void cleanup() {
+        PooledSlotObject **p = &first;
+        last = nullptr;
+        while (PooledSlotObject *s = *p) {
+            if (!s->dispatcher.load(std::memory_order_relaxed)) {
+                *p = s->next;
+                s->destroyIfLastRef();
+            } else {
+                last = s;
+                p = &s->next;
+            }
+        }
+        dirty = false;
+    }
+
+public:
+    QMetaObject::Connection connection;
+
+    PooledSlotDispatcher() = default;
+    PooledSlotDispatcher(const PooledSlotDispatcher &) = delete;
+    PooledSlotDispatcher &operator=(const PooledSlotDispatcher &) = delete;
+    ~PooledSlotDispatcher() {
+        while (PooledSlotObject *s = first) {
+            first = s->next;
+            s->dispatcher.store(nullptr, std::memory_order_release);
+            s->destroyIfLastRef();
+        }
+    }
+
+    /// False once the connection is disconnected, by QObject::disconnect or by the destruction of
+    /// the sender: the functors will not be called anymore.
+    bool isConnected() const { return bool(connection); }
+
+    void append(PooledSlotObject *s) {
+        s->dispatcher.store(this, std::memory_order_relaxed);
+        (last ? last->next : first) = s;
+        last = s;
+    }
+    void remove(PooledSlotObject *s) {
+        s->dispatcher.store(nullptr, std::memory_order_relaxed);
+        dirty = true;
+        if (!emitting)
+            cleanup();
+    }
+
+    /// Calls the slots, in the order of connection. The ones connected during the emission are not
+    /// called, and the ones disconnected during the emission are not called anymore.
+    void activate(void **args) {
+        PooledSlotObject *end = last;
+        if (!end)
+            return;
+        ++emitting;
+        for (PooledSlotObject *s = first; s; s = s->next) {
+            if (s->dispatcher.load(std::memory_order_relaxed))
+                s->call(args);
+            if (s == end || !isConnected())
+                break;
+        }
+        if (--emitting == 0 && dirty)
+            cleanup();
+    }
+};
+
+inline bool PooledSlotObject::isConnected() const {
+    PooledSlotDispatcher *d = dispatcher.load(std::memory_order_acquire);
+    return d && d->isConnected();
+}
+
+/// The dispatchers of the pooled connections made in the current thread, by sender and signal.
+/// The map only has weak references, so the dispatchers never need to access it: an entry is not
+/// used anymore once its dispatcher is disconnected (the sender may have been destroyed, and another
+/// object created at the same address), and the entries of the destroyed dispatchers are removed
+/// when the map grows.
+class PooledSlotDispatcherRegistry {
+    struct Key {
+        const QObject *sender;
+        int signalIndex;
+        bool operator==(const Key &other) const { return sender == other.sender && signalIndex == other.signalIndex; }
+    };
+    struct KeyHash {
+        size_t operator()(const Key &k) const {
+            return std::hash<const void *>()(k.sender) ^ (size_t(k.signalIndex) * 0x9e3779b9u);
+        }
+    };
+    std::unordered_map<Key, std::weak_ptr<PooledSlotDispatcher>, KeyHash> map;
+    size_t sweepSize = 16;
+
+public:
+    static PooledSlotDispatcherRegistry &local() {
+        static thread_local PooledSlotDispatcherRegistry registry;
+        return registry;
+    }
+
+    /// The connected dispatcher of the signal of the sender, or null
+    std::shared_ptr<PooledSlotDispatcher> find(const QObject *sender, int signalIndex) const {
+        auto it = map.find({sender, signalIndex});
+        if (it == map.end())
+            return nullptr;
+        std::shared_ptr<PooledSlotDispatcher> dispatcher = it->second.lock();
+        return dispatcher && dispatcher->isConnected() ? dispatcher : nullptr;
+    }
+    void insert(const QObject *sender, int signalIndex, const std::shared_ptr<PooledSlotDispatcher> &dispatcher) {
+        map[{sender, signalIndex}] = dispatcher;
+        if (map.size() < sweepSize)
+            return;
+        for (auto it = map.begin(); it != map.end();)
+            it = it->second.expired() ? map.erase(it) : std::next(it);
+        sweepSize = std::max(size_t(16), map.size() * 2);
+    }
+};
+
+/// The functor of the QObject::connect of a dispatcher
+template<typename ArgList> struct PooledSlotDispatcherCaller;
+template<typename... Args>
+struct PooledSlotDispatcherCaller<QtPrivate::List<Args...>> {
+    std::shared_ptr<PooledSlotDispatcher> dispatcher;
+    void operator()(const std::decay_t<Args> &... args) const {
+        void *argv[] = { nullptr, const_cast<void *>(static_cast<const void *>(std::addressof(args)))... };
+        dispatcher->activate(argv);
+    }
+};
+
+} // namespace w_internal
+
+namespace w_cpp {
+
+/// Handle of a connection made with w_cpp::connectPooled. Like QMetaObject::Connection, destroying
+/// the handle does not disconnect.
+class PooledConnection {
+    w_internal::PooledSlotObject *m_slot = nullptr;
+public:
+    PooledConnection() = default;
+    explicit PooledConnection(w_internal::PooledSlotObject *slot) : m_slot(slot) {
+        if (m_slot)
+            m_slot->ref();
+    }
+    PooledConnection(const PooledConnection &other) : PooledConnection(other.m_slot) {}
+    PooledConnection(PooledConnection &&other) noexcept : m_slot(other.m_slot) { other.m_slot = nullptr; }
+    PooledConnection &operator=(PooledConnection other) noexcept {
+        std::swap(m_slot, other.m_slot);
+        return *this;
+    }
+    ~PooledConnection() {
+        if (m_slot)
+            m_slot->destroyIfLastRef();
+    }
+
+    /// Whether the functor is still connected. Only in the thread of the sender.
+    explicit operator bool() const { return m_slot && m_slot->isConnected(); }
+
+    /// Disconnects the functor. Returns false if it was already disconnected.
+    bool disconnect() const {
+        if (!m_slot || !m_slot->isConnected())
+            return false;
+        m_slot->dispatcher.load(std::memory_order_relaxed)->remove(m_slot);
+        return true;
+    }
+};
+
+/// Same as QObject::connect(sender, signal, functor), but the slot objects of the functors are
+/// allocated from a thread-local pool instead of the heap, and only the first functor connected to
+/// a signal of a sender calls QObject::connect: the next ones are added to that connection. So
+/// connecting a functor and disconnecting it again does not allocate.
+/// The functor is called with as many arguments of the signal as it takes, directly when the signal
+/// is emitted in the thread of the sender (or queued in it otherwise), after the ones connected
+/// before it. It is destroyed when it is disconnected or when the sender is destroyed.
+/// Unlike QObject::connect, the pooled connections of a sender must be made, disconnected and
+/// checked (with PooledConnection::operator bool) in the thread of the sender, and the sender must
+/// be destroyed in its thread. Only copying and destroying the handles may be done in any thread.
+template<typename Func1, typename Functor>
+PooledConnection connectPooled(const typename QtPrivate::FunctionPointer<Func1>::Object *sender,
+                               Func1 signal, Functor &&functor) {
+    using Arguments = typename QtPrivate::FunctionPointer<Func1>::Arguments;
+    using Slot = w_internal::PooledFunctorSlot<std::decay_t<Functor>, Arguments>;
+    const int signalIndex = QMetaMethod::fromSignal(signal).methodIndex();
+    auto &registry = w_internal::PooledSlotDispatcherRegistry::local();
+    std::shared_ptr<w_internal::PooledSlotDispatcher> dispatcher = registry.find(sender, signalIndex);
+    if (!dispatcher) {
+        dispatcher = std::make_shared<w_internal::PooledSlotDispatcher>();
+        dispatcher->connection = QObject::connect(sender, signal, sender,
+                                                  w_internal::PooledSlotDispatcherCaller<Arguments>{dispatcher});
+        if (!dispatcher->isConnected())
+            return PooledConnection();
+        registry.insert(sender, signalIndex, dispatcher);
+    }
+    w_internal::PooledSlotObject *slot = Slot::create(std::decay_t<Functor>(std::forward<Functor>(functor)));
+    dispatcher->append(slot);
+    return PooledConnection(slot);
+}
+
+/// Disconnects a connection made with connectPooled. Returns false if it was already disconnected.
+inline bool disconnect(const PooledConnection &connection) { return connection.disconnect(); }
+
+} // namespace w_cpp
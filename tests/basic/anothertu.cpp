@@ -21,6 +21,9 @@
 
 W_GADGET_IMPL(AnotherTU::Gaga)
 
+void AnotherTU::BaseObject::baseSlot(int v) { baseCalls += v; }
+W_OBJECT_IMPL(AnotherTU::BaseObject)
+
 #ifdef Q_NAMESPACE // Since Qt 5.8
 W_NAMESPACE_IMPL(AnotherTU)
 #endif
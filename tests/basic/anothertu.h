@@ -32,6 +32,15 @@ public:
 };
 
 
+struct BaseObject : QObject {
+    W_OBJECT(BaseObject)
+public:
+    int m_baseProp = 0;
+    W_PROPERTY(int, baseProp MEMBER m_baseProp)
+    int baseCalls = 0;
+    void baseSlot(int v); W_SLOT(baseSlot)
+};
+
 struct InlineGadget {
     W_GADGET(InlineGadget)
 public:
@@ -69,6 +69,60 @@ private slots:
     void testAnotherTU();
     W_SLOT(testAnotherTU, W_Access::Private)
 
+    void baseInAnotherTU();
+    W_SLOT(baseInAnotherTU, W_Access::Private)
+
+    void outlinedSignals();
+    W_SLOT(outlinedSignals, W_Access::Private)
+
+    void signalArgumentCopies();
+    W_SLOT(signalArgumentCopies, W_Access::Private)
+
+    void optionalSignalReturn();
+    W_SLOT(optionalSignalReturn, W_Access::Private)
+
+    void constructInPlace();
+    W_SLOT(constructInPlace, W_Access::Private)
+
+    void typedPropertyAccess();
+    W_SLOT(typedPropertyAccess, W_Access::Private)
+
+    void propertyCopies();
+    W_SLOT(propertyCopies, W_Access::Private)
+
+    void memberPropertyCompare();
+    W_SLOT(memberPropertyCompare, W_Access::Private)
+
+    void bindableProperty();
+    W_SLOT(bindableProperty, W_Access::Private)
+
+    void cachedProperty();
+    W_SLOT(cachedProperty, W_Access::Private)
+
+    void trackPropertyChanges();
+    W_SLOT(trackPropertyChanges, W_Access::Private)
+
+    void propertyTransaction();
+    W_SLOT(propertyTransaction, W_Access::Private)
+
+    void indexOfMethod();
+    W_SLOT(indexOfMethod, W_Access::Private)
+
+    void typedInvoke();
+    W_SLOT(typedInvoke, W_Access::Private)
+
+    void compileTimeConnect();
+    W_SLOT(compileTimeConnect, W_Access::Private)
+
+    void staticConnect();
+    W_SLOT(staticConnect, W_Access::Private)
+
+    void pooledConnect();
+    W_SLOT(pooledConnect, W_Access::Private)
+
+    void pooledConnectTeardown();
+    W_SLOT(pooledConnectTeardown, W_Access::Private)
+
     void testFinal();
     W_SLOT(testFinal, W_Access::Private)
 
@@ -77,8 +131,14 @@ private slots:
 };
 
 #include <wobjectimpl.h>
+#include <wobjectpool.h>
 
 #include <QtTest/QtTest>
+#include <thread>
+#include <vector>
+#if __cplusplus > 201700L
+#include <optional>
+#endif
 
 W_OBJECT_IMPL(tst_Basic)
 
@@ -402,6 +462,141 @@ void tst_Basic::testAnotherTU()
 #endif
 }
 
+struct DerivedFromAnotherTU : AnotherTU::BaseObject {
+    W_OBJECT(DerivedFromAnotherTU)
+public:
+    int m_derivedProp = 0;
+    W_PROPERTY(int, derivedProp MEMBER m_derivedProp)
+    int derivedCalls = 0;
+    void derivedSlot(int v) { derivedCalls += v; } W_SLOT(derivedSlot)
+};
+W_OBJECT_IMPL(DerivedFromAnotherTU)
+
+struct DerivedFromAnotherTU2 : DerivedFromAnotherTU {
+    W_OBJECT(DerivedFromAnotherTU2)
+};
+W_OBJECT_IMPL(DerivedFromAnotherTU2)
+
+void tst_Basic::baseInAnotherTU()
+{
+    // qt_metacall dispatches directly to the class of the hierarchy owning the index
+    DerivedFromAnotherTU2 obj;
+    QVERIFY(QMetaObject::invokeMethod(&obj, "baseSlot", Q_ARG(int, 3)));
+    QVERIFY(QMetaObject::invokeMethod(&obj, "derivedSlot", Q_ARG(int, 5)));
+    QCOMPARE(obj.baseCalls, 3);
+    QCOMPARE(obj.derivedCalls, 5);
+    QVERIFY(obj.setProperty("baseProp", 7));
+    QVERIFY(obj.setProperty("derivedProp", 11));
+    QCOMPARE(obj.m_baseProp, 7);
+    QCOMPARE(obj.m_derivedProp, 11);
+    QCOMPARE(obj.property("baseProp"), QVariant(7));
+    QCOMPARE(obj.property("derivedProp"), QVariant(11));
+    QVERIFY(obj.setProperty("objectName", QStringLiteral("name")));
+    QCOMPARE(obj.objectName(), QStringLiteral("name"));
+}
+
+class OutlinedSignals : public QObject {
+    W_OBJECT(OutlinedSignals)
+    W_OUTLINE_SIGNALS
+public:
+    void valueChanged(int v) W_SIGNAL(valueChanged, v)
+    void otherValueChanged(const int &v) W_SIGNAL(otherValueChanged, v)
+    int query(int v) const W_SIGNAL(query, v)
+};
+W_OBJECT_IMPL(OutlinedSignals)
+
+class OutlinedSignalsSub : public OutlinedSignals {
+    W_OBJECT(OutlinedSignalsSub)
+public:
+    void subSignal(int v) W_SIGNAL(subSignal, v)
+};
+W_OBJECT_IMPL(OutlinedSignalsSub)
+
+void tst_Basic::outlinedSignals()
+{
+    static_assert(decltype(w_internal::SignalEmission::isOutlined<OutlinedSignals>(0))::value, "");
+    static_assert(!decltype(w_internal::SignalEmission::isOutlined<OutlinedSignalsSub>(0))::value, "");
+
+    OutlinedSignalsSub obj;
+    int last = 0;
+    QObject::connect(&obj, &OutlinedSignals::valueChanged, [&](int v) { last = v; });
+    QObject::connect(&obj, &OutlinedSignals::otherValueChanged, [&](int v) { last = -v; });
+    QObject::connect(&obj, &OutlinedSignalsSub::subSignal, [&](int v) { last = v * 10; });
+    emit obj.valueChanged(2);
+    QCOMPARE(last, 2);
+    emit obj.otherValueChanged(3);
+    QCOMPARE(last, -3);
+    emit obj.subSignal(4);
+    QCOMPARE(last, 40);
+
+    QCOMPARE(emit obj.query(5), 0);
+    QObject::connect(&obj, &OutlinedSignals::query, [](int v) { return v + 1; });
+    QCOMPARE(emit obj.query(5), 6);
+}
+
+struct CopyCounter {
+    int *copies = nullptr;
+    CopyCounter() = default;
+    CopyCounter(const CopyCounter &o) : copies(o.copies) { if (copies) ++*copies; }
+    CopyCounter &operator=(const CopyCounter &o) { copies = o.copies; if (copies) ++*copies; return *this; }
+};
+Q_DECLARE_METATYPE(CopyCounter)
+W_REGISTER_ARGTYPE(CopyCounter)
+
+class CopyCounterEmitter : public QObject {
+    W_OBJECT(CopyCounterEmitter)
+public:
+    void byValue(CopyCounter c) W_SIGNAL(byValue, c)
+    void byConstRef(const CopyCounter &c) W_SIGNAL(byConstRef, c)
+};
+W_OBJECT_IMPL(CopyCounterEmitter)
+
+void tst_Basic::signalArgumentCopies()
+{
+    CopyCounterEmitter obj;
+    int copies = 0;
+    CopyCounter c;
+    c.copies = &copies;
+    QObject::connect(&obj, &CopyCounterEmitter::byValue, [](const CopyCounter &) {});
+    QObject::connect(&obj, &CopyCounterEmitter::byConstRef, [](const CopyCounter &) {});
+
+    emit obj.byValue(c);
+    QCOMPARE(copies, 1); // only the copy done by the caller
+    copies = 0;
+    emit obj.byConstRef(c);
+    QCOMPARE(copies, 0);
+}
+
+#if __cplusplus > 201700L
+struct NoDefaultResult {
+    explicit NoDefaultResult(int v) : value(v) {}
+    int value;
+};
+Q_DECLARE_METATYPE(std::optional<NoDefaultResult>)
+W_REGISTER_ARGTYPE(std::optional<NoDefaultResult>)
+
+class OptionalQuery : public QObject {
+    W_OBJECT(OptionalQuery)
+public:
+    std::optional<NoDefaultResult> query() W_SIGNAL(query)
+};
+W_OBJECT_IMPL(OptionalQuery)
+#endif
+
+void tst_Basic::optionalSignalReturn()
+{
+#if __cplusplus > 201700L
+    OptionalQuery obj;
+    QVERIFY(!emit obj.query());
+    QObject::connect(&obj, &OptionalQuery::query, [] { return NoDefaultResult(42); });
+    auto result = emit obj.query();
+    QVERIFY(result);
+    QCOMPARE(result->value, 42);
+#else
+    QSKIP("Requires C++17");
+#endif
+}
+
 struct TestFinalObject final : public QObject {
     W_OBJECT(TestFinalObject)
 public:
@@ -421,6 +616,708 @@ public:
 };
 W_GADGET_IMPL(TestFinalGadget)
 
+class Constructible : public QObject {
+    W_OBJECT(Constructible)
+public:
+    static int alive;
+    int value = 0;
+    Constructible() { ++alive; }
+    W_CONSTRUCTOR()
+    Constructible(int v) : value(v) { ++alive; }
+    W_CONSTRUCTOR(int)
+    Constructible(int a, int b) : value(a * b) { ++alive; }
+    W_CONSTRUCTOR(int, int)
+    ~Constructible() { --alive; }
+};
+int Constructible::alive = 0;
+W_OBJECT_IMPL(Constructible)
+
+template<typename T> struct CountingAllocator {
+    using value_type = T;
+    int *allocations;
+    explicit CountingAllocator(int *a) : allocations(a) {}
+    template<typename U> CountingAllocator(const CountingAllocator<U> &o) : allocations(o.allocations) {}
+    T *allocate(std::size_t n) { ++*allocations; return std::allocator<T>().allocate(n); }
+    void deallocate(T *p, std::size_t n) { --*allocations; std::allocator<T>().deallocate(p, n); }
+};
+
+void tst_Basic::constructInPlace()
+{
+    QScopedPointer<QObject> obj(Constructible::staticMetaObject.newInstance(Q_ARG(int, 6), Q_ARG(int, 7)));
+    QVERIFY(qobject_cast<Constructible *>(obj.data()));
+    QCOMPARE(static_cast<Constructible *>(obj.data())->value, 42);
+    obj.reset();
+    QCOMPARE(Constructible::alive, 0);
+
+    int a = 3, b = 4;
+    void *args[] = { nullptr, &a, &b };
+    alignas(Constructible) char storage[sizeof(Constructible)];
+    Constructible *c = w_cpp::constructInPlace<Constructible>(storage, 1, args);
+    QCOMPARE(static_cast<void *>(c), static_cast<void *>(storage));
+    QCOMPARE(c->value, 3);
+    QCOMPARE(Constructible::alive, 1);
+    c->~Constructible();
+    QVERIFY(!w_cpp::constructInPlace<Constructible>(storage, 3, args));
+    QCOMPARE(Constructible::alive, 0);
+
+    int allocations = 0;
+    CountingAllocator<Constructible> allocator(&allocations);
+    c = w_cpp::createInstance<Constructible>(allocator, 2, args);
+    QVERIFY(c);
+    QCOMPARE(c->value, 12);
+    QCOMPARE(allocations, 1);
+    w_cpp::destroyInstance(allocator, c);
+    QCOMPARE(allocations, 0);
+    QCOMPARE(Constructible::alive, 0);
+
+    QVERIFY(!w_cpp::createInstance<Constructible>(allocator, -1, args));
+    QCOMPARE(allocations, 0);
+}
+
+class TypedProperties : public QObject {
+    W_OBJECT(TypedProperties)
+public:
+    double m_opacity = 1;
+    int counter = 0;
+    double opacity() const { return m_opacity; }
+    void setOpacity(double o) { m_opacity = o; }
+    void counterChanged(int c) W_SIGNAL(counterChanged, c)
+
+    W_PROPERTY(double, opacity READ opacity WRITE setOpacity)
+    W_PROPERTY(int, counter MEMBER counter NOTIFY counterChanged)
+};
+W_OBJECT_IMPL(TypedProperties)
+
+void tst_Basic::typedPropertyAccess()
+{
+    constexpr int opacityIndex = w_cpp::propertyIndex<TypedProperties>("opacity");
+    constexpr int counterIndex = w_cpp::propertyIndex<TypedProperties>("counter");
+    const QMetaObject &mo = TypedProperties::staticMetaObject;
+    QCOMPARE(opacityIndex + mo.propertyOffset(), mo.indexOfProperty("opacity"));
+    QCOMPARE(counterIndex + mo.propertyOffset(), mo.indexOfProperty("counter"));
+
+    TypedProperties obj;
+    w_cpp::setProperty<TypedProperties, opacityIndex>(&obj, 0.5);
+    QCOMPARE(obj.m_opacity, 0.5);
+    QCOMPARE((w_cpp::getProperty<TypedProperties, opacityIndex>(&obj)), 0.5);
+
+    int notified = 0;
+    QObject::connect(&obj, &TypedProperties::counterChanged, [&](int c) { notified = c; });
+    w_cpp::setProperty<TypedProperties, counterIndex>(&obj, 3);
+    QCOMPARE(obj.counter, 3);
+    QCOMPARE(notified, 3);
+    QCOMPARE(obj.property("counter").toInt(), 3);
+
+#if defined(__cpp_nontype_template_args) && __cpp_nontype_template_args >= 201911L
+    w_cpp::setProperty<TypedProperties, "opacity">(&obj, 0.25);
+    QCOMPARE((w_cpp::getProperty<TypedProperties, "opacity">(&obj)), 0.25);
+#endif
+}
+
+struct MoveCounter {
+    static int copies;
+    static int moves;
+    int value = 0;
+    MoveCounter() = default;
+    MoveCounter(int v) : value(v) {}
+    MoveCounter(const MoveCounter &o) : value(o.value) { ++copies; }
+    MoveCounter(MoveCounter &&o) noexcept : value(o.value) { ++moves; }
+    MoveCounter &operator=(const MoveCounter &o) { value = o.value; ++copies; return *this; }
+    MoveCounter &operator=(MoveCounter &&o) noexcept { value = o.value; ++moves; return *this; }
+};
+int MoveCounter::copies = 0;
+int MoveCounter::moves = 0;
+Q_DECLARE_METATYPE(MoveCounter)
+W_REGISTER_ARGTYPE(MoveCounter)
+W_REGISTER_ARGTYPE(std::vector<MoveCounter>)
+
+class MoveCounterProperties : public QObject {
+    W_OBJECT(MoveCounterProperties)
+public:
+    MoveCounter m_byValue;
+    MoveCounter m_member;
+    MoveCounter byValue() const { return m_byValue; }
+    void setByValue(MoveCounter c) { m_byValue = std::move(c); }
+
+    W_PROPERTY(MoveCounter, byValue READ byValue WRITE setByValue)
+    W_PROPERTY(MoveCounter, member MEMBER m_member)
+};
+W_OBJECT_IMPL(MoveCounterProperties)
+
+void tst_Basic::propertyCopies()
+{
+    MoveCounterProperties obj;
+    MoveCounter::copies = MoveCounter::moves = 0;
+    w_cpp::setProperty<MoveCounterProperties, 0>(&obj, MoveCounter(1));
+    QCOMPARE(obj.m_byValue.value, 1);
+    QCOMPARE(MoveCounter::copies, 0);
+    w_cpp::setProperty<MoveCounterProperties, 1>(&obj, MoveCounter(2));
+    QCOMPARE(obj.m_member.value, 2);
+    QCOMPARE(MoveCounter::copies, 0);
+
+    // only the copy done by the getter, or of the member
+    MoveCounter::copies = MoveCounter::moves = 0;
+    QCOMPARE((w_cpp::getProperty<MoveCounterProperties, 0>(&obj).value), 1);
+    QCOMPARE((w_cpp::getProperty<MoveCounterProperties, 1>(&obj).value), 2);
+    QCOMPARE(MoveCounter::copies, 2);
+
+    // the metacalls move the result of the getter, but do not move the value they are given
+    MoveCounter::copies = MoveCounter::moves = 0;
+    MoveCounter value;
+    void *argv[] = { &value };
+    QMetaObject::metacall(&obj, QMetaObject::ReadProperty, obj.metaObject()->indexOfProperty("byValue"), argv);
+    QCOMPARE(value.value, 1);
+    QCOMPARE(MoveCounter::copies, 1);
+    value.value = 3;
+    MoveCounter::copies = 0;
+    QMetaObject::metacall(&obj, QMetaObject::WriteProperty, obj.metaObject()->indexOfProperty("byValue"), argv);
+    QCOMPARE(obj.m_byValue.value, 3);
+    QCOMPARE(value.value, 3);
+    QCOMPARE(MoveCounter::copies, 1);
+}
+
+class MemberProperties : public QObject {
+    W_OBJECT(MemberProperties)
+public:
+    QString text;
+    QString uncompared;
+    MoveCounter counter; // no operator!=
+    std::vector<MoveCounter> counters; // operator!= declared, but the elements have no operator==
+    void changed() W_SIGNAL(changed)
+
+    W_PROPERTY(QString, text MEMBER text NOTIFY changed)
+    W_PROPERTY(QString, uncompared MEMBER uncompared NOTIFY changed W_NO_COMPARE)
+    W_PROPERTY(MoveCounter, counter MEMBER counter NOTIFY changed)
+    W_PROPERTY(std::vector<MoveCounter>, counters MEMBER counters NOTIFY changed)
+};
+W_OBJECT_IMPL(MemberProperties)
+
+void tst_Basic::memberPropertyCompare()
+{
+    MemberProperties obj;
+    int notified = 0;
+    QObject::connect(&obj, &MemberProperties::changed, [&] { ++notified; });
+
+    QVERIFY(obj.setProperty("text", QString("a")));
+    QCOMPARE(notified, 1);
+    QVERIFY(obj.setProperty("text", QString("a")));
+    QCOMPARE(notified, 1);
+    w_cpp::setProperty<MemberProperties, 0>(&obj, QString("a"));
+    QCOMPARE(notified, 1);
+    w_cpp::setProperty<MemberProperties, 0>(&obj, QString("b"));
+    QCOMPARE(obj.text, QString("b"));
+    QCOMPARE(notified, 2);
+
+    QVERIFY(obj.setProperty("uncompared", QString("a")));
+    QVERIFY(obj.setProperty("uncompared", QString("a")));
+    QCOMPARE(notified, 4);
+
+    w_cpp::setProperty<MemberProperties, 2>(&obj, MoveCounter(1));
+    w_cpp::setProperty<MemberProperties, 2>(&obj, MoveCounter(1));
+    QCOMPARE(notified, 6);
+
+    w_cpp::setProperty<MemberProperties, 3>(&obj, std::vector<MoveCounter>(1));
+    w_cpp::setProperty<MemberProperties, 3>(&obj, std::vector<MoveCounter>(1));
+    QCOMPARE(obj.counters.size(), size_t(1));
+    QCOMPARE(notified, 8);
+}
+
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+class BindableProperties : public QObject {
+    W_OBJECT(BindableProperties)
+public:
+    int value() const { return m_value; }
+    void setValue(int v) { m_value = v; }
+    QBindable<int> bindableValue() { return &m_value; }
+    void valueChanged() W_SIGNAL(valueChanged)
+    int plain = 0;
+
+    Q_OBJECT_BINDABLE_PROPERTY(BindableProperties, int, m_value, &BindableProperties::valueChanged)
+    W_PROPERTY(int, value READ value WRITE setValue NOTIFY valueChanged BINDABLE bindableValue)
+    W_PROPERTY(int, plain MEMBER plain)
+};
+W_OBJECT_IMPL(BindableProperties)
+#endif
+
+void tst_Basic::bindableProperty()
+{
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+    BindableProperties obj;
+    const QMetaObject *mo = obj.metaObject();
+    const QMetaProperty prop = mo->property(mo->indexOfProperty("value"));
+    QVERIFY(prop.isBindable());
+    QVERIFY(!mo->property(mo->indexOfProperty("plain")).isBindable());
+    QVERIFY(!mo->property(mo->indexOfProperty("plain")).bindable(&obj).isValid());
+
+    int notified = 0;
+    QObject::connect(&obj, &BindableProperties::valueChanged, [&] { ++notified; });
+    QProperty<int> source(2);
+    obj.bindableValue().setBinding([&] { return source.value() * 10; });
+    QCOMPARE(obj.value(), 20);
+    source = 3;
+    QCOMPARE(obj.value(), 30);
+    QVERIFY(notified > 0);
+
+    // through the meta object
+    QUntypedBindable bindable = prop.bindable(&obj);
+    QVERIFY(bindable.isValid());
+    QVERIFY(bindable.setBinding(Qt::makePropertyBinding(source)));
+    QCOMPARE(obj.value(), 3);
+    source = 4;
+    QCOMPARE(obj.property("value").toInt(), 4);
+    QVERIFY(bindable.hasBinding());
+#else
+    QSKIP("Bindable properties need Qt 6");
+#endif
+}
+
+class CachedProperties : public QObject {
+    W_OBJECT(CachedProperties)
+public:
+    int width = 2, height = 3;
+    mutable int computations = 0;
+    int area() const { ++computations; return width * height; }
+    int perimeter() const { ++computations; return 2 * (width + height); }
+    void setWidth(int w) { width = w; emit sizeChanged(); }
+    void sizeChanged() W_SIGNAL(sizeChanged)
+    void otherChanged() W_SIGNAL(otherChanged)
+
+    W_PROPERTY(int, area READ area NOTIFY sizeChanged W_CACHED)
+    W_PROPERTY(int, perimeter READ perimeter NOTIFY sizeChanged)
+    W_CACHED_PROPERTIES
+};
+W_OBJECT_IMPL(CachedProperties)
+
+void tst_Basic::cachedProperty()
+{
+    CachedProperties obj;
+    QCOMPARE(obj.property("area").toInt(), 6);
+    QCOMPARE(obj.property("area").toInt(), 6);
+    QCOMPARE((w_cpp::getProperty<CachedProperties, 0>(&obj)), 6);
+    QCOMPARE(obj.computations, 1);
+
+    // other signals do not invalidate the value
+    emit obj.otherChanged();
+    QCOMPARE(obj.property("area").toInt(), 6);
+    QCOMPARE(obj.computations, 1);
+
+    obj.setWidth(4);
+    QCOMPARE(obj.property("area").toInt(), 12);
+    QCOMPARE(obj.property("area").toInt(), 12);
+    QCOMPARE(obj.computations, 2);
+
+    // properties without W_CACHED call the getter each time
+    QCOMPARE(obj.property("perimeter").toInt(), 14);
+    QCOMPARE(obj.property("perimeter").toInt(), 14);
+    QCOMPARE(obj.computations, 4);
+
+    // W_CACHED is not visible in the meta object
+    const QMetaObject *mo = obj.metaObject();
+    QCOMPARE(mo->property(mo->indexOfProperty("area")).isConstant(), false);
+    QCOMPARE(mo->property(mo->indexOfProperty("area")).hasNotifySignal(), true);
+}
+
+class TrackedProperties : public QObject {
+    W_OBJECT(TrackedProperties)
+public:
+    int x = 0, y = 0;
+    QString name;
+    void positionChanged() W_SIGNAL(positionChanged)
+    void nameChanged() W_SIGNAL(nameChanged)
+    void otherChanged() W_SIGNAL(otherChanged)
+
+    W_PROPERTY(int, x MEMBER x NOTIFY positionChanged)
+    W_PROPERTY(int, y MEMBER y NOTIFY positionChanged)
+    W_PROPERTY(QString, name MEMBER name NOTIFY nameChanged)
+    W_PROPERTY(int, constant MEMBER x CONSTANT)
+    W_TRACK_PROPERTY_CHANGES
+};
+W_OBJECT_IMPL(TrackedProperties)
+
+void tst_Basic::trackPropertyChanges()
+{
+    TrackedProperties obj;
+    auto changed = [&] {
+        QList<int> result;
+        for (int i : w_cpp::changedProperties(&obj))
+            result.append(i);
+        return result;
+    };
+    QVERIFY(!w_cpp::changedProperties(&obj).any());
+
+    emit obj.otherChanged();
+    QCOMPARE(changed(), QList<int>());
+    emit obj.positionChanged();
+    QCOMPARE(changed(), (QList<int>{0, 1}));
+    obj.setProperty("name", QStringLiteral("foo"));
+    QCOMPARE(changed(), (QList<int>{0, 1, 2}));
+
+    auto taken = w_cpp::takeChangedProperties(&obj);
+    QCOMPARE(taken.count(), 3);
+    QVERIFY(taken.test(2));
+    QVERIFY(!taken.test(3));
+    QVERIFY(!w_cpp::changedProperties(&obj).any());
+
+    // writing the same value does not notify
+    obj.setProperty("name", QStringLiteral("foo"));
+    QVERIFY(!w_cpp::changedProperties(&obj).any());
+    w_cpp::setProperty<TrackedProperties, 0>(&obj, 42);
+    QCOMPARE(changed(), (QList<int>{0, 1}));
+}
+
+class TransactionProperties : public QObject {
+    W_OBJECT(TransactionProperties)
+public:
+    int width = 0, height = 0, value = 0;
+    void setWidth(int w) { if (w != width) { width = w; emit sizeChanged(); } }
+    void setHeight(int h) { if (h != height) { height = h; emit sizeChanged(); } }
+    void sizeChanged() W_SIGNAL(sizeChanged)
+    void valueChanged(int value) W_SIGNAL(valueChanged, value)
+    void propertiesChanged(const QBitArray &changed) W_SIGNAL(propertiesChanged, changed)
+
+    W_PROPERTY(int, width MEMBER width WRITE setWidth NOTIFY sizeChanged)
+    W_PROPERTY(int, height MEMBER height WRITE setHeight NOTIFY sizeChanged)
+    W_PROPERTY(int, value MEMBER value NOTIFY valueChanged)
+    W_TRACK_PROPERTY_CHANGES
+};
+W_OBJECT_IMPL(TransactionProperties)
+
+void tst_Basic::propertyTransaction()
+{
+    TransactionProperties obj;
+    QSignalSpy sizeSpy(&obj, &TransactionProperties::sizeChanged);
+    QSignalSpy valueSpy(&obj, &TransactionProperties::valueChanged);
+    QSignalSpy aggregatedSpy(&obj, &TransactionProperties::propertiesChanged);
+
+    {
+        w_cpp::PropertyTransaction<TransactionProperties> transaction(&obj);
+        obj.setWidth(1);
+        obj.setHeight(2);
+        obj.setProperty("value", 3);
+        obj.setProperty("value", 4);
+        QCOMPARE(sizeSpy.count(), 0);
+        QCOMPARE(valueSpy.count(), 0);
+    }
+    QCOMPARE(sizeSpy.count(), 1);
+    QCOMPARE(valueSpy.count(), 1);
+    QCOMPARE(valueSpy.at(0).at(0).toInt(), 4);
+    QCOMPARE(aggregatedSpy.count(), 0);
+
+    obj.setWidth(5);
+    QCOMPARE(sizeSpy.count(), 2);
+
+    {
+        w_cpp::PropertyTransaction<TransactionProperties> transaction(&obj, &TransactionProperties::propertiesChanged);
+        {
+            // nested transactions do not emit anything
+            w_cpp::PropertyTransaction<TransactionProperties> nested(&obj);
+            obj.setProperty("value", 6);
+        }
+        QCOMPARE(valueSpy.count(), 1);
+        transaction.commit();
+        QCOMPARE(aggregatedSpy.count(), 1);
+        const QBitArray changed = aggregatedSpy.at(0).at(0).toBitArray();
+        QCOMPARE(changed.size(), 3);
+        QVERIFY(!changed.testBit(0));
+        QVERIFY(changed.testBit(2));
+    }
+    QCOMPARE(aggregatedSpy.count(), 1);
+    QCOMPARE(sizeSpy.count(), 2);
+    QCOMPARE(valueSpy.count(), 1);
+
+    // nothing changed
+    { w_cpp::PropertyTransaction<TransactionProperties> transaction(&obj); }
+    QCOMPARE(sizeSpy.count(), 2);
+    QCOMPARE(valueSpy.count(), 1);
+}
+
+class IndexOfMethodBase : public QObject {
+    W_OBJECT(IndexOfMethodBase)
+public:
+    void valueChanged(int v) W_SIGNAL(valueChanged, v)
+    void update() {}
+    W_SLOT(update, ())
+    void update(int) {}
+    W_SLOT(update, (int))
+    void reset() {}
+    W_INVOKABLE(reset)
+};
+W_OBJECT_IMPL(IndexOfMethodBase)
+
+// Only the derived class has a name table: the methods of the base class are looked up by Qt
+class IndexOfMethodDerived : public IndexOfMethodBase {
+    W_OBJECT(IndexOfMethodDerived)
+    W_NAME_INDEX
+public:
+    void update(const QString &) {}
+    W_SLOT(update, (const QString &))
+    void update(double) {}
+    W_INVOKABLE(update, (double))
+};
+W_OBJECT_IMPL(IndexOfMethodDerived)
+
+void tst_Basic::indexOfMethod()
+{
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+    const QMetaObject *mo = &IndexOfMethodDerived::staticMetaObject;
+    // same result as Qt for every method of the hierarchy, including the ones of QObject
+    for (int i = 0; i < mo->methodCount(); ++i) {
+        const QByteArray signature = mo->method(i).methodSignature();
+        QCOMPARE(w_cpp::indexOfMethod(mo, signature), mo->indexOfMethod(signature.constData()));
+        QCOMPARE(w_cpp::indexOfSignal(mo, signature), mo->indexOfSignal(signature.constData()));
+        QCOMPARE(w_cpp::indexOfSlot(mo, signature), mo->indexOfSlot(signature.constData()));
+    }
+    QCOMPARE(w_cpp::indexOfMethod(mo, "update(bool)"), -1);
+    QCOMPARE(w_cpp::indexOfMethod(mo, "update"), -1);
+    QCOMPARE(w_cpp::indexOfMethod(mo, "nothing()"), -1);
+
+    QCOMPARE(w_cpp::indexOfMethodByName(mo, "update"), mo->indexOfMethod("update(double)"));
+    QCOMPARE(w_cpp::indexOfMethodByName(mo, "reset"), mo->indexOfMethod("reset()"));
+    QCOMPARE(w_cpp::indexOfMethodByName(mo, "deleteLater"), mo->indexOfMethod("deleteLater()"));
+    QCOMPARE(w_cpp::indexOfMethodByName(mo, "nothing"), -1);
+#endif
+}
+
+class TypedInvoke : public QObject {
+    W_OBJECT(TypedInvoke)
+public:
+    int value = 0;
+    double ratio = 0;
+    int calls = 0;
+    void set(int v, double r) { value = v; ratio = r; ++calls; }
+    W_SLOT(set)
+    void bump() { ++calls; }
+    W_SLOT(bump, ())
+    void bump(int n) { calls += n; }
+    W_SLOT(bump, (int))
+    int twice(int v) { ++calls; return v * 2; }
+    W_INVOKABLE(twice)
+};
+W_OBJECT_IMPL(TypedInvoke)
+
+void tst_Basic::typedInvoke()
+{
+#if __cplusplus > 201700L && !defined(Q_CC_MSVC)
+    TypedInvoke obj;
+    QVERIFY(w_cpp::invoke<&TypedInvoke::set>(&obj, Qt::DirectConnection, 1, 0.5));
+    QCOMPARE(obj.value, 1);
+    QCOMPARE(obj.ratio, 0.5);
+    QVERIFY(w_cpp::invoke<&TypedInvoke::set>(&obj, Qt::AutoConnection, 2, 1)); // int converted to double
+    QCOMPARE(obj.ratio, 1.);
+    QCOMPARE(obj.calls, 2);
+
+    QVERIFY(w_cpp::invoke<&TypedInvoke::set>(&obj, Qt::QueuedConnection, 3, 1.5));
+    QVERIFY(w_cpp::invoke<static_cast<void (TypedInvoke::*)(int)>(&TypedInvoke::bump)>(&obj, Qt::QueuedConnection, 10));
+    QVERIFY(w_cpp::invoke<static_cast<void (TypedInvoke::*)()>(&TypedInvoke::bump)>(&obj, Qt::QueuedConnection));
+    QVERIFY(w_cpp::invoke<&TypedInvoke::twice>(&obj, Qt::QueuedConnection, 4));
+    QCOMPARE(obj.calls, 2);
+    QCoreApplication::processEvents();
+    QCOMPARE(obj.value, 3);
+    QCOMPARE(obj.ratio, 1.5);
+    QCOMPARE(obj.calls, 2 + 1 + 10 + 1 + 1);
+
+    QVERIFY(!w_cpp::invoke<&TypedInvoke::twice>(static_cast<TypedInvoke *>(nullptr), Qt::DirectConnection, 1));
+#endif
+}
+
+class ConnectSender : public QObject {
+    W_OBJECT(ConnectSender)
+public:
+    void valueChanged(int v) W_SIGNAL(valueChanged, v)
+    void relayed(int v) W_SIGNAL(relayed, v)
+};
+W_OBJECT_IMPL(ConnectSender)
+
+void tst_Basic::compileTimeConnect()
+{
+    ConnectSender sender;
+    TypedInvoke receiver;
+    QVERIFY(W_CONNECT(&sender, &ConnectSender::valueChanged, &receiver, &TypedInvoke::twice));
+    QVERIFY(W_CONNECT(&sender, &ConnectSender::valueChanged, &sender, &ConnectSender::relayed));
+    int relayed = 0;
+    connect(&sender, &ConnectSender::relayed, [&](int v) { relayed = v; });
+    emit sender.valueChanged(4);
+    QCOMPARE(receiver.calls, 1);
+    QCOMPARE(relayed, 4);
+
+    QVERIFY(W_DISCONNECT(&sender, &ConnectSender::valueChanged, &receiver, &TypedInvoke::twice));
+    QVERIFY(!W_DISCONNECT(&sender, &ConnectSender::valueChanged, &receiver, &TypedInvoke::twice));
+    emit sender.valueChanged(5);
+    QCOMPARE(receiver.calls, 1);
+    QCOMPARE(relayed, 5);
+
+    // queued, to a slot that takes fewer arguments than the signal
+    QVERIFY((w_cpp::connect<decltype(&ConnectSender::valueChanged), &ConnectSender::valueChanged,
+                            decltype(static_cast<void (TypedInvoke::*)()>(&TypedInvoke::bump)),
+                            static_cast<void (TypedInvoke::*)()>(&TypedInvoke::bump)>(&sender, &receiver, Qt::QueuedConnection)));
+    emit sender.valueChanged(6);
+    QCOMPARE(receiver.calls, 1);
+    QCoreApplication::processEvents();
+    QCOMPARE(receiver.calls, 2);
+}
+
+class StaticConnections : public QObject {
+    W_OBJECT(StaticConnections)
+public:
+    int value = 0;
+    double ratio = 0;
+    int resets = 0;
+    QObject child;
+    void valueChanged(int v) W_SIGNAL(valueChanged, v)
+    void changed(int v, double r) W_SIGNAL(changed, v, r)
+    void otherSignal(int v) W_SIGNAL(otherSignal, v)
+    void setValue(int v) { value = v; }
+    W_SLOT(setValue)
+    void reset() { ++resets; }
+    void set(int v, double r) { value = v; ratio = r; }
+    void nameChild(int v) { child.setObjectName(QString::number(v)); }
+
+    W_STATIC_CONNECT(valueChanged, setValue)
+    W_STATIC_CONNECT(valueChanged, reset)
+    W_STATIC_CONNECT(valueChanged, nameChild)
+    W_STATIC_CONNECT(changed, set)
+};
+W_OBJECT_IMPL(StaticConnections)
+
+void tst_Basic::staticConnect()
+{
+    StaticConnections obj;
+    QCOMPARE(obj.receivers(SIGNAL(valueChanged(int))), 0);
+    emit obj.valueChanged(3);
+    QCOMPARE(obj.value, 3);
+    QCOMPARE(obj.resets, 1);
+    QCOMPARE(obj.child.objectName(), QString("3"));
+    emit obj.changed(4, 0.5);
+    QCOMPARE(obj.value, 4);
+    QCOMPARE(obj.ratio, 0.5);
+    QCOMPARE(obj.resets, 1);
+    emit obj.otherSignal(5);
+    QCOMPARE(obj.value, 4);
+
+    // dynamic connections keep working, and are called after the static ones
+    int seen = -1;
+    connect(&obj, &StaticConnections::valueChanged, [&](int) { seen = obj.value; });
+    emit obj.valueChanged(6);
+    QCOMPARE(seen, 6);
+    QCOMPARE(obj.resets, 2);
+
+    QSignalBlocker blocker(&obj);
+    emit obj.valueChanged(7);
+    QCOMPARE(obj.value, 6);
+}
+
+class PooledSender : public QObject {
+    W_OBJECT(PooledSender)
+public:
+    void changed(int v, double r) W_SIGNAL(changed, v, r)
+    void otherSignal() W_SIGNAL(otherSignal)
+};
+W_OBJECT_IMPL(PooledSender)
+
+struct CountedFunctor {
+    static int alive;
+    int *sum;
+    explicit CountedFunctor(int *s) : sum(s) { ++alive; }
+    CountedFunctor(const CountedFunctor &o) : sum(o.sum) { ++alive; }
+    ~CountedFunctor() { --alive; }
+    void operator()(int v) const { *sum += v; }
+};
+int CountedFunctor::alive = 0;
+
+void tst_Basic::pooledConnect()
+{
+    w_cpp::PooledConnection kept;
+    int sum = 0;
+    {
+        PooledSender sender;
+        double ratio = 0;
+        auto c1 = w_cpp::connectPooled(&sender, &PooledSender::changed, CountedFunctor(&sum));
+        auto c2 = w_cpp::connectPooled(&sender, &PooledSender::changed, [&](int v, double r) { sum += v; ratio = r; });
+        int others = 0;
+        auto c3 = w_cpp::connectPooled(&sender, &PooledSender::otherSignal, [&] { ++others; });
+        QVERIFY(c1 && c2 && c3);
+        // one real connection per signal
+        QCOMPARE(sender.receivers(SIGNAL(changed(int,double))), 1);
+        QCOMPARE(CountedFunctor::alive, 1);
+
+        emit sender.changed(3, 0.5);
+        QCOMPARE(sum, 6);
+        QCOMPARE(ratio, 0.5);
+        QCOMPARE(others, 0);
+        emit sender.otherSignal();
+        QCOMPARE(others, 1);
+
+        QVERIFY(w_cpp::disconnect(c1));
+        QVERIFY(!w_cpp::disconnect(c1));
+        QVERIFY(!c1);
+        QCOMPARE(CountedFunctor::alive, 1); // still referenced by c1
+        c1 = w_cpp::PooledConnection();
+        QCOMPARE(CountedFunctor::alive, 0);
+        emit sender.changed(2, 1.5);
+        QCOMPARE(sum, 8);
+
+        // disconnecting or connecting while the signal is emitted
+        int calls = 0;
+        w_cpp::PooledConnection self;
+        self = w_cpp::connectPooled(&sender, &PooledSender::otherSignal, [&] {
+            ++calls;
+            self.disconnect();
+            w_cpp::connectPooled(&sender, &PooledSender::otherSignal, [&] { calls += 100; });
+        });
+        emit sender.otherSignal();
+        QCOMPARE(calls, 1);
+        emit sender.otherSignal();
+        QCOMPARE(calls, 101);
+
+        kept = w_cpp::connectPooled(&sender, &PooledSender::changed, CountedFunctor(&sum));
+        QCOMPARE(CountedFunctor::alive, 1);
+    }
+    // the functors are disconnected with the sender, and destroyed with the last handle
+    QVERIFY(!kept);
+    QCOMPARE(CountedFunctor::alive, 1);
+    kept = w_cpp::PooledConnection();
+    QCOMPARE(CountedFunctor::alive, 0);
+}
+
+struct PooledConnectionHolder { w_cpp::PooledConnection connection; };
+
+void tst_Basic::pooledConnectTeardown()
+{
+    int sum = 0;
+    {
+        // Disconnected while it emits: Qt keeps the dispatcher alive until the end of the emission,
+        // but it must not be used for the next pooled connections of the sender
+        PooledSender sender;
+        int late = 0;
+        auto c1 = w_cpp::connectPooled(&sender, &PooledSender::changed, [&] {
+            QObject::disconnect(&sender, nullptr, nullptr, nullptr);
+            w_cpp::connectPooled(&sender, &PooledSender::changed, [&](int v) { late += v; });
+        });
+        auto c2 = w_cpp::connectPooled(&sender, &PooledSender::changed, CountedFunctor(&sum));
+        emit sender.changed(1, 0);
+        QCOMPARE(sum, 0);
+        QCOMPARE(late, 0);
+        QVERIFY(!c1);
+        QVERIFY(!c2);
+        QVERIFY(!w_cpp::disconnect(c2));
+        emit sender.changed(2, 0);
+        QCOMPARE(sum, 0);
+        QCOMPARE(late, 2);
+    }
+    QCOMPARE(CountedFunctor::alive, 0);
+
+    // A handle released after the pool of its thread is destroyed
+    std::thread thread([&] {
+        static thread_local PooledConnectionHolder holder; // constructed before the pool, so destroyed after it
+        PooledSender sender;
+        holder.connection = w_cpp::connectPooled(&sender, &PooledSender::changed, CountedFunctor(&sum));
+        emit sender.changed(3, 0);
+    });
+    thread.join();
+    QCOMPARE(sum, 3);
+    QCOMPARE(CountedFunctor::alive, 0);
+}
+
 void tst_Basic::testFinal()
 {
     {
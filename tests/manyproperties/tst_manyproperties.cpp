@@ -33,6 +33,7 @@ private slots:
 class HasManyProperties : public QObject
 {
     W_OBJECT(HasManyProperties)
+    W_NAME_INDEX // for w_cpp::indexOfProperty
 public:
 #define DeclareProperty(Type, Name) \
     Type m_##Name; \
@@ -142,6 +143,26 @@ void tst_ManyProperties::manyProperties() {
         QCOMPARE(prop.hasNotifySignal(), true);
         QCOMPARE(prop.notifySignal().name(), QByteArray("intProp0Changed"));
     }
+    {   // every property, first to last, can be written and read back
+        const QMetaObject *mo = obj.metaObject();
+        for (int i = mo->propertyOffset(); i < mo->propertyCount(); ++i) {
+            QMetaProperty prop = mo->property(i);
+            const QVariant value = prop.userType() == QMetaType::Int ? QVariant(i) : QVariant(QString::number(i));
+            QVERIFY(prop.write(&obj, value));
+            QCOMPARE(prop.read(&obj), value);
+        }
+    }
+#if QT_VERSION >= QT_VERSION_CHECK(6,0,0)
+    {   // the perfect hash lookup finds the same index as Qt, including for the properties of QObject
+        const QMetaObject *mo = obj.metaObject();
+        for (int i = 0; i < mo->propertyCount(); ++i) {
+            const QByteArray name = mo->property(i).name();
+            QCOMPARE(w_cpp::indexOfProperty(mo, name), mo->indexOfProperty(name.constData()));
+        }
+        QCOMPARE(w_cpp::indexOfProperty(mo, "prop61"), -1);
+        QCOMPARE(w_cpp::indexOfProperty(mo, ""), -1);
+    }
+#endif
 }
 
 QTEST_MAIN(tst_ManyProperties)
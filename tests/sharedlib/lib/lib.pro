@@ -0,0 +1,9 @@
+TEMPLATE = lib
+TARGET = sharedbase
+QT = core
+CONFIG += shared hide_symbols
+DEFINES += SHAREDBASE_LIBRARY
+DESTDIR = $$OUT_PWD/..
+include(../../../src/verdigris.pri)
+HEADERS = sharedbase.h
+SOURCES = sharedbase.cpp
@@ -0,0 +1,50 @@
+/****************************************************************************
+ *  Copyright (C) 2026 Woboq GmbH
+ *  Olivier Goffart <contact at woboq.com>
+ *  https://woboq.com/
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this program.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QtCore/QObject>
+#include <wobjectdefs.h>
+
+#if defined(SHAREDBASE_LIBRARY)
+#  define SHAREDBASE_EXPORT Q_DECL_EXPORT
+#else
+#  define SHAREDBASE_EXPORT Q_DECL_IMPORT
+#endif
+
+// W_OBJECT classes exported from a shared library built with hidden visibility, so their
+// qt_static_metacall cannot be referenced from outside the library.
+class SHAREDBASE_EXPORT SharedBase : public QObject {
+    W_OBJECT(SharedBase)
+public:
+    int calls = 0;
+    int m_baseProp = 0;
+    void baseChanged(int value) W_SIGNAL(baseChanged, value)
+    void baseSlot(int v); W_SLOT(baseSlot)
+    W_PROPERTY(int, baseProp MEMBER m_baseProp NOTIFY baseChanged)
+};
+
+class SHAREDBASE_EXPORT SharedMiddle : public SharedBase {
+    W_OBJECT(SharedMiddle)
+public:
+    int m_middleProp = 0;
+    void middleSlot(int v); W_SLOT(middleSlot)
+    W_PROPERTY(int, middleProp MEMBER m_middleProp)
+};
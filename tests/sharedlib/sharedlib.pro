@@ -0,0 +1,3 @@
+TEMPLATE = subdirs
+SUBDIRS = lib test
+test.depends = lib
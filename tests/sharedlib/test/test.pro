@@ -0,0 +1,8 @@
+CONFIG += testcase
+TARGET = tst_sharedlib
+QT = core testlib
+include(../../../src/verdigris.pri)
+INCLUDEPATH += ../lib
+LIBS += -L$$OUT_PWD/.. -lsharedbase
+QMAKE_RPATHDIR += $$OUT_PWD/..
+SOURCES = tst_sharedlib.cpp
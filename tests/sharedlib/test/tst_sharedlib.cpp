@@ -0,0 +1,67 @@
+/****************************************************************************
+ *  Copyright (C) 2026 Woboq GmbH
+ *  Olivier Goffart <contact at woboq.com>
+ *  https://woboq.com/
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this program.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <sharedbase.h>
+#include <wobjectimpl.h>
+#include <QtTest/QtTest>
+
+// A W_OBJECT class whose W_OBJECT base classes are in another shared library
+class SharedDerived : public SharedMiddle {
+    W_OBJECT(SharedDerived)
+public:
+    int m_derivedProp = 0;
+    void derivedSlot(int v) { calls += 100 * v; } W_SLOT(derivedSlot)
+    W_PROPERTY(int, derivedProp MEMBER m_derivedProp)
+};
+W_OBJECT_IMPL(SharedDerived)
+
+class tst_SharedLib : public QObject
+{
+    W_OBJECT(tst_SharedLib)
+
+private:
+    void metacallThroughLibrary();
+    W_SLOT(metacallThroughLibrary, W_Access::Private)
+};
+
+void tst_SharedLib::metacallThroughLibrary()
+{
+    SharedDerived obj;
+    QVERIFY(QMetaObject::invokeMethod(&obj, "baseSlot", Q_ARG(int, 1)));
+    QVERIFY(QMetaObject::invokeMethod(&obj, "middleSlot", Q_ARG(int, 1)));
+    QVERIFY(QMetaObject::invokeMethod(&obj, "derivedSlot", Q_ARG(int, 1)));
+    QCOMPARE(obj.calls, 111);
+
+    QVERIFY(obj.setProperty("baseProp", 1));
+    QVERIFY(obj.setProperty("middleProp", 2));
+    QVERIFY(obj.setProperty("derivedProp", 3));
+    QCOMPARE(obj.m_baseProp, 1);
+    QCOMPARE(obj.m_middleProp, 2);
+    QCOMPARE(obj.m_derivedProp, 3);
+    QCOMPARE(obj.property("baseProp").toInt(), 1);
+    QCOMPARE(obj.property("middleProp").toInt(), 2);
+    QCOMPARE(obj.property("derivedProp").toInt(), 3);
+
+    QSignalSpy spy(&obj, &SharedBase::baseChanged);
+    emit obj.baseChanged(4);
+    QCOMPARE(spy.count(), 1);
+}
+
+QTEST_MAIN(tst_SharedLib)
+W_OBJECT_IMPL(tst_SharedLib)
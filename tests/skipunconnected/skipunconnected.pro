@@ -0,0 +1,5 @@
+CONFIG += testcase
+TARGET = tst_skipunconnected
+QT = core core-private testlib
+SOURCES = tst_skipunconnected.cpp
+include(../../src/verdigris.pri)
@@ -0,0 +1,125 @@
+/****************************************************************************
+ *  Copyright (C) 2026 Woboq GmbH
+ *  Olivier Goffart <contact at woboq.com>
+ *  https://woboq.com/
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this program.
+ *  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <wobjectimpl.h>
+#include <QtTest/QtTest>
+#include <QtCore/private/qobject_p.h> // qt_register_signal_spy_callbacks
+
+// Needs the private headers of QtCore to observe the calls to QMetaObject::activate
+class tst_SkipUnconnected : public QObject
+{
+    W_OBJECT(tst_SkipUnconnected)
+
+private:
+    void skipUnconnectedSignals();
+    W_SLOT(skipUnconnectedSignals, W_Access::Private)
+};
+
+class SkipUnconnected : public QObject {
+    W_OBJECT(SkipUnconnected)
+    W_SKIP_UNCONNECTED_SIGNALS
+public:
+    void valueChanged(int v) W_SIGNAL(valueChanged, v)
+    int query() W_SIGNAL(query)
+    int received = 0;
+    void setReceived(int v) { received = v; } W_SLOT(setReceived)
+    int queries = 0;
+    void countQuery() { ++queries; } W_SLOT(countQuery)
+};
+W_OBJECT_IMPL(SkipUnconnected)
+
+class SkipUnconnectedSub : public SkipUnconnected {
+    W_OBJECT(SkipUnconnectedSub)
+public:
+    void subSignal(int v) W_SIGNAL(subSignal, v)
+};
+W_OBJECT_IMPL(SkipUnconnectedSub)
+
+/// Counts the calls to QMetaObject::activate for the signals of 'sender', with the signal spy
+/// callbacks, which are called even when the signal is not connected
+struct ActivationCounter {
+    static const QObject *sender;
+    static int count;
+    static void countActivation(QObject *caller, int, void **) {
+        if (caller == sender)
+            ++count;
+    }
+    QSignalSpyCallbackSet callbacks = { countActivation, nullptr, nullptr, nullptr };
+
+    explicit ActivationCounter(const QObject *o) {
+        sender = o;
+        count = 0;
+#if QT_VERSION >= QT_VERSION_CHECK(5,14,0)
+        qt_register_signal_spy_callbacks(&callbacks);
+#else
+        qt_register_signal_spy_callbacks(callbacks);
+#endif
+    }
+    ~ActivationCounter() {
+#if QT_VERSION >= QT_VERSION_CHECK(5,14,0)
+        qt_register_signal_spy_callbacks(nullptr);
+#else
+        qt_register_signal_spy_callbacks(QSignalSpyCallbackSet{});
+#endif
+        sender = nullptr;
+    }
+};
+const QObject *ActivationCounter::sender = nullptr;
+int ActivationCounter::count = 0;
+
+void tst_SkipUnconnected::skipUnconnectedSignals()
+{
+    SkipUnconnectedSub obj;
+    ActivationCounter activations(&obj);
+
+    // QMetaObject::activate is not called for the unconnected signals of SkipUnconnected
+    emit obj.valueChanged(1);
+    QCOMPARE(emit obj.query(), 0);
+    QCOMPARE(activations.count, 0);
+    // but it is for the signals of the derived class, which does not use W_SKIP_UNCONNECTED_SIGNALS
+    emit obj.subSignal(1);
+    QCOMPARE(activations.count, 1);
+
+    int last = 0;
+    auto c1 = QObject::connect(&obj, &SkipUnconnected::valueChanged, [&](int v) { last = v; });
+    emit obj.valueChanged(2);
+    QCOMPARE(last, 2);
+    QCOMPARE(activations.count, 2);
+
+    // connections by index call connectNotify too
+    QMetaObject::connect(&obj, SkipUnconnected::staticMetaObject.indexOfSignal("query()"),
+                         &obj, SkipUnconnected::staticMetaObject.indexOfSlot("countQuery()"));
+    emit obj.query();
+    QCOMPARE(activations.count, 3);
+    QCOMPARE(obj.queries, 1);
+
+    QObject::connect(&obj, &SkipUnconnected::query, [] { return 42; });
+    QCOMPARE(emit obj.query(), 42);
+
+    QObject::connect(&obj, SIGNAL(subSignal(int)), &obj, SLOT(setReceived(int)));
+    emit obj.subSignal(3);
+    QCOMPARE(obj.received, 3);
+
+    QObject::disconnect(c1);
+    emit obj.valueChanged(4);
+    QCOMPARE(last, 2);
+}
+
+QTEST_MAIN(tst_SkipUnconnected)
+W_OBJECT_IMPL(tst_SkipUnconnected)
@@ -3,3 +3,7 @@ TEMPLATE = subdirs
 SUBDIRS += internal basic qt templates manyproperties
 
 !gcc:SUBDIRS += cppapi
+# The base classes are exported from a library built with hidden visibility (GCC and Clang)
+!win32:SUBDIRS += sharedlib
+# Needs the private headers of QtCore
+qtHaveModule(core-private):SUBDIRS += skipunconnected
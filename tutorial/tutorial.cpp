@@ -221,10 +221,19 @@ public:
     W_PROPERTY(QString, prop3 MEMBER m_value NOTIFY valueChanged)
     //equivalent to
     W_PROPERTY(QString, prop4, &PropertyTutorial::m_value, W_Notify, &PropertyTutorial::valueChanged)
+    // Like with moc, writing a MEMBER property with its current value does not emit the NOTIFY
+    // signal. W_NO_COMPARE skips that comparison, for types whose operator!= is expensive.
+    W_PROPERTY(QString, prop5 MEMBER m_value NOTIFY valueChanged W_NO_COMPARE)
+    // W_CACHED keeps the value returned by the getter until the NOTIFY signal is emitted.
+    // (needs W_CACHED_PROPERTIES, see below)
+    W_PROPERTY(QString, prop6 READ value NOTIFY valueChanged W_CACHED)
 
     // Optionally, you can put parentheses around the type, useful if it contains a comma
     QMap<int, int> m_map;
     W_PROPERTY((QMap<int,int>), map  MEMBER m_map)
+
+    // Storage for the W_CACHED properties, after all the W_PROPERTY
+    W_CACHED_PROPERTIES
 };
 
 W_OBJECT_IMPL(PropertyTutorial)